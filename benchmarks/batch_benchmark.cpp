@@ -0,0 +1,98 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/batch.hpp>
+#include <subsetix/intersection/v1.hpp>
+#include <subsetix/intersection/batch.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <utility>
+#include <vector>
+
+namespace {
+
+using namespace subsetix;
+using subsetix::intersection::v1::intersect_batch;
+using subsetix::intersection::v1::intersect_meshes;
+using subsetix::intersection::v1::mesh_to;
+
+// ============================================================================
+// Benchmark helpers
+// ============================================================================
+
+// n x n rows, one interval [shift, shift + n) per row
+Mesh3DDevice make_small_block(Coord n, Coord shift) {
+  Mesh3DHost host;
+  const std::size_t nrows = static_cast<std::size_t>(n) * static_cast<std::size_t>(n);
+  host.row_keys = Mesh3DHost::RowKeyView("bench_row_keys", nrows);
+  host.row_ptr = Mesh3DHost::IndexView("bench_row_ptr", nrows + 1);
+  host.intervals = Mesh3DHost::IntervalView("bench_intervals", nrows);
+  host.num_rows = nrows;
+  host.num_intervals = nrows;
+
+  std::size_t i = 0;
+  for (Coord y = 0; y < n; ++y) {
+    for (Coord z = 0; z < n; ++z) {
+      host.row_keys(i) = {y, z};
+      host.row_ptr(i) = i;
+      host.intervals(i) = {shift, shift + n};
+      ++i;
+    }
+  }
+  host.row_ptr(nrows) = nrows;
+
+  return mesh_to<Kokkos::DefaultExecutionSpace::memory_space>(host);
+}
+
+std::vector<std::pair<Mesh3DDevice, Mesh3DDevice>> make_pairs(std::size_t num_pairs) {
+  std::vector<std::pair<Mesh3DDevice, Mesh3DDevice>> pairs;
+  pairs.reserve(num_pairs);
+  for (std::size_t p = 0; p < num_pairs; ++p) {
+    pairs.emplace_back(make_small_block(8, 0), make_small_block(8, static_cast<Coord>(p % 8)));
+  }
+  return pairs;
+}
+
+// ============================================================================
+// Benchmark: many small pairs - one call per pair vs one batched call
+// ============================================================================
+
+static void BM_Intersection_ManySmallPairs_Loop(benchmark::State& state) {
+  const auto pairs = make_pairs(static_cast<std::size_t>(state.range(0)));
+
+  for (auto _ : state) {
+    for (const auto& pair : pairs) {
+      auto result = intersect_meshes(pair.first, pair.second);
+      benchmark::DoNotOptimize(result);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_Intersection_ManySmallPairs_Batch(benchmark::State& state) {
+  const auto pairs = make_pairs(static_cast<std::size_t>(state.range(0)));
+  std::vector<Mesh3DDevice> first;
+  std::vector<Mesh3DDevice> second;
+  for (const auto& pair : pairs) {
+    first.push_back(pair.first);
+    second.push_back(pair.second);
+  }
+  const MeshBatchDevice batch_a = make_batch(first);
+  const MeshBatchDevice batch_b = make_batch(second);
+
+  for (auto _ : state) {
+    auto result = intersect_batch(batch_a, batch_b);
+    Kokkos::fence();
+    benchmark::DoNotOptimize(result);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_Intersection_ManySmallPairs_Loop)->Arg(100)->Arg(1000);
+BENCHMARK(BM_Intersection_ManySmallPairs_Batch)->Arg(100)->Arg(1000);
+
+} // anonymous namespace
@@ -0,0 +1,167 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/field.hpp>
+#include <subsetix/generators.hpp>
+#include <subsetix/intersection/v1.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include "mesh_cache.hpp"
+#include "memory_counters.hpp"
+#include "traffic_counters.hpp"
+
+#include <cstdint>
+#include <string>
+
+namespace {
+
+using namespace subsetix;
+using subsetix::intersection::v1::intersect_inplace;
+using subsetix::intersection::v1::intersect_meshes;
+namespace gen = subsetix::generators;
+
+// ============================================================================
+// Mesh pairs: A and B of each pair come from the same family
+// ============================================================================
+
+struct MeshPair {
+  Mesh3DDevice a;
+  Mesh3DDevice b;
+};
+
+// Two shells of radius n / 2 whose centres differ by n / 8 along every axis
+MeshPair sphere_pair(Coord n) {
+  const Coord r = n / 2;
+  return {gen::generate(gen::SphereShell{r, r - r / 4, r}),
+          gen::generate(gen::SphereShell{r + n / 8, r - r / 4, r})};
+}
+
+MeshPair boxes_pair(Coord n) {
+  return {gen::generate(gen::RandomBoxes{n, 16, 0.25, 1}),
+          gen::generate(gen::RandomBoxes{n, 16, 0.25, 2})};
+}
+
+MeshPair striped_pair(Coord n) {
+  return {gen::generate(gen::StripedRows{n, 3, 2, 1}),
+          gen::generate(gen::StripedRows{n, 4, 1, 2})};
+}
+
+// Sponge against the box that trims one cell off each of its faces
+MeshPair menger_pair(Coord level) {
+  const gen::MengerSponge sponge{static_cast<int>(level)};
+  const Coord e = sponge.extent() - 1;
+  return {gen::generate(sponge), gen::generate(gen::Box{{1, 1, 1}, {e, e, e}})};
+}
+
+MeshPair power_law_pair(Coord n) {
+  return {gen::generate(gen::PowerLawRows{n, 1.2, 4096, 1}),
+          gen::generate(gen::PowerLawRows{n, 1.2, 4096, 2})};
+}
+
+// Level 1 of two 3-level hierarchies over [0, n)^3 placed from different seeds
+MeshPair amr_pair(Coord n) {
+  return {gen::generate(gen::amr_level(n, 3, 1, 1)), gen::generate(gen::amr_level(n, 3, 1, 2))};
+}
+
+using PairFactory = MeshPair (*)(Coord);
+
+// Pairs are generated once per family and size and shared by the benchmarks
+const MeshPair& cached_pair(benchmark::State& state, const char* family, PairFactory make_pair) {
+  const auto n = static_cast<Coord>(state.range(0));
+  return bench::Cache<MeshPair>::get(std::string(family) + "/" + std::to_string(n),
+                                     [&] { return make_pair(n); });
+}
+
+// Deep copy, so that in-place operations never touch the shared input
+Mesh3DDevice copy_mesh(const Mesh3DDevice& src) {
+  Mesh3DDevice dst = src;
+  dst.row_keys = Mesh3DDevice::RowKeyView(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "bench_row_keys"), src.row_keys.extent(0));
+  dst.row_ptr = Mesh3DDevice::IndexView(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "bench_row_ptr"), src.row_ptr.extent(0));
+  dst.intervals = Mesh3DDevice::IntervalView(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "bench_intervals"),
+      src.intervals.extent(0));
+  Kokkos::deep_copy(dst.row_keys, src.row_keys);
+  Kokkos::deep_copy(dst.row_ptr, src.row_ptr);
+  Kokkos::deep_copy(dst.intervals, src.intervals);
+  return dst;
+}
+
+std::int64_t count_intervals(const MeshPair& p) {
+  return static_cast<std::int64_t>(p.a.num_intervals + p.b.num_intervals);
+}
+
+// Cells of both inputs, the work behind the cells/s counter
+double pair_cells(const MeshPair& p) {
+  return static_cast<double>(count_cells(p.a) + count_cells(p.b));
+}
+
+// ============================================================================
+// Benchmarks: every set operation over every family
+// ============================================================================
+
+void run_intersect(benchmark::State& state, const char* family, PairFactory make_pair) {
+  const MeshPair& p = cached_pair(state, family, make_pair);
+
+  for (auto _ : state) {
+    auto result = intersect_meshes(p.a, p.b);
+    benchmark::DoNotOptimize(result);
+  }
+
+  state.SetItemsProcessed(state.iterations() * count_intervals(p));
+  state.counters["rows_a"] = static_cast<double>(p.a.num_rows);
+  state.counters["intervals_a"] = static_cast<double>(p.a.num_intervals);
+
+  const Mesh3DDevice r = intersect_meshes(p.a, p.b);
+  const auto traffic = bench::intersection_traffic(p.a, p.b, r);
+  bench::report_bandwidth(state, traffic, pair_cells(p));
+  bench::report_phase_bandwidth(state, "intersect_meshes", traffic, [&] {
+    auto result = intersect_meshes(p.a, p.b);
+    benchmark::DoNotOptimize(result);
+  });
+  bench::report_memory(state, [&] {
+    auto result = intersect_meshes(p.a, p.b);
+    benchmark::DoNotOptimize(result);
+  });
+}
+
+void run_intersect_inplace(benchmark::State& state, const char* family, PairFactory make_pair) {
+  const MeshPair& p = cached_pair(state, family, make_pair);
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    Mesh3DDevice a = copy_mesh(p.a);
+    state.ResumeTiming();
+
+    intersect_inplace(a, p.b);
+    benchmark::DoNotOptimize(a);
+  }
+
+  state.SetItemsProcessed(state.iterations() * count_intervals(p));
+  Mesh3DDevice a = copy_mesh(p.a);
+  bench::report_memory(state, [&] { intersect_inplace(a, p.b); });
+}
+
+#define SUBSETIX_FAMILY_BENCHMARKS(name, factory, ...)                    \
+  static void BM_Intersect_##name(benchmark::State& state) {             \
+    run_intersect(state, #name, factory);                                \
+  }                                                                      \
+  static void BM_IntersectInplace_##name(benchmark::State& state) {      \
+    run_intersect_inplace(state, #name, factory);                        \
+  }                                                                      \
+  BENCHMARK(BM_Intersect_##name)->__VA_ARGS__;                           \
+  BENCHMARK(BM_IntersectInplace_##name)->__VA_ARGS__
+
+SUBSETIX_FAMILY_BENCHMARKS(SphereShell, sphere_pair, Arg(64)->Arg(256)->Arg(1024));
+SUBSETIX_FAMILY_BENCHMARKS(RandomBoxes, boxes_pair, Arg(128)->Arg(512)->Arg(1024));
+SUBSETIX_FAMILY_BENCHMARKS(StripedRows, striped_pair, Arg(64)->Arg(256)->Arg(512));
+SUBSETIX_FAMILY_BENCHMARKS(MengerSponge, menger_pair, Arg(3)->Arg(5)->Arg(6));
+SUBSETIX_FAMILY_BENCHMARKS(PowerLawRows, power_law_pair, Arg(256)->Arg(1024)->Arg(2048));
+SUBSETIX_FAMILY_BENCHMARKS(AmrNested, amr_pair, Arg(128)->Arg(512)->Arg(1024));
+
+#undef SUBSETIX_FAMILY_BENCHMARKS
+
+} // anonymous namespace
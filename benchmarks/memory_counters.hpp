@@ -0,0 +1,43 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <subsetix/profiling.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <Kokkos_Core.hpp>
+
+namespace subsetix::bench {
+
+/**
+ * @brief Run op once more with the AllocationTracker on and export its
+ *        footprint as counters.
+ *
+ * Call after the timing loop, so that the tracker's callbacks never add to
+ * measured time. Counters: peak_bytes (high-water mark of the operation,
+ * result included), allocs and alloc_bytes (per call).
+ */
+template <class Op>
+void report_memory(benchmark::State& state, Op&& op) {
+  auto& tracker = profiling::AllocationTracker::instance();
+  tracker.reset();
+  tracker.enable(false);
+  op();
+  Kokkos::fence("report_memory");
+  tracker.disable();
+
+  std::size_t allocations = 0;
+  std::size_t bytes = 0;
+  for (const auto& [name, m] : tracker.operations()) {
+    allocations += m.allocations;
+    bytes += m.bytes_allocated;
+  }
+  state.counters["peak_bytes"] = static_cast<double>(tracker.max_operation_peak());
+  state.counters["allocs"] = static_cast<double>(allocations);
+  state.counters["alloc_bytes"] = static_cast<double>(bytes);
+  tracker.reset();
+}
+
+} // namespace subsetix::bench
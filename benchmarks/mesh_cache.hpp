@@ -0,0 +1,54 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <subsetix/mesh.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <map>
+#include <string>
+#include <utility>
+
+namespace subsetix::bench {
+
+/**
+ * @brief Inputs shared by every benchmark of the binary, built once per key.
+ *
+ * Benchmarks run one after the other and each size is re-entered for every
+ * repetition, so building inputs inside the benchmark function would repeat
+ * the (often dominant) setup cost. Entries live until Kokkos::finalize,
+ * which releases them through a finalize hook.
+ */
+template <class Value>
+class Cache {
+public:
+  template <class Factory>
+  static Value& get(const std::string& key, Factory&& make) {
+    auto& entries = storage();
+    auto it = entries.find(key);
+    if (it == entries.end()) {
+      it = entries.emplace(key, make()).first;
+    }
+    return it->second;
+  }
+
+private:
+  // Never destroyed: a static map would release its Views after finalize
+  static std::map<std::string, Value>& storage() {
+    static std::map<std::string, Value>* entries = [] {
+      auto* map = new std::map<std::string, Value>();
+      Kokkos::push_finalize_hook([map] { map->clear(); });
+      return map;
+    }();
+    return *entries;
+  }
+};
+
+template <class Factory>
+const Mesh3DDevice& cached_mesh(const std::string& key, Factory&& make) {
+  return Cache<Mesh3DDevice>::get(key, std::forward<Factory>(make));
+}
+
+} // namespace subsetix::bench
@@ -0,0 +1,108 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/generators.hpp>
+#include <subsetix/reference.hpp>
+#include <subsetix/intersection/v1.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include "mesh_cache.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using namespace subsetix;
+using subsetix::intersection::v1::intersect_meshes;
+namespace gen = subsetix::generators;
+namespace ref = subsetix::reference;
+
+// ============================================================================
+// Reference (host, std containers) baselines
+// ============================================================================
+//
+// Each benchmark times the reference implementation and reports
+// device_speedup: its time over the median time of the Kokkos kernel on the
+// same inputs, i.e. what the Kokkos path buys on the current backend.
+
+struct ReferencePair {
+  Mesh3DDevice a;
+  Mesh3DDevice b;
+  ref::Rows rows_a;
+  ref::Rows rows_b;
+};
+
+template <class Family>
+const ReferencePair& cached_pair(const std::string& key, const Family& fa, const Family& fb) {
+  return bench::Cache<ReferencePair>::get(key, [&] {
+    ReferencePair p;
+    p.a = gen::generate(fa);
+    p.b = gen::generate(fb);
+    p.rows_a = ref::to_rows(p.a);
+    p.rows_b = ref::to_rows(p.b);
+    return p;
+  });
+}
+
+// Median wall time of a few fenced runs of op
+template <class Op>
+double median_seconds(Op&& op, int runs = 5) {
+  std::vector<double> times;
+  op();  // warm-up
+  Kokkos::fence("median_seconds");
+  for (int r = 0; r < runs; ++r) {
+    const auto start = std::chrono::steady_clock::now();
+    op();
+    Kokkos::fence("median_seconds");
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    times.push_back(std::chrono::duration<double>(elapsed).count());
+  }
+  std::nth_element(times.begin(), times.begin() + runs / 2, times.end());
+  return times[runs / 2];
+}
+
+void run_reference_intersect(benchmark::State& state, const ReferencePair& p) {
+  for (auto _ : state) {
+    ref::Rows result = ref::intersect(p.rows_a, p.rows_b);
+    benchmark::DoNotOptimize(result);
+  }
+
+  const double reference = median_seconds([&] {
+    ref::Rows result = ref::intersect(p.rows_a, p.rows_b);
+    benchmark::DoNotOptimize(result);
+  });
+  const double device = median_seconds([&] {
+    auto result = intersect_meshes(p.a, p.b);
+    benchmark::DoNotOptimize(result);
+  });
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<std::int64_t>(p.a.num_intervals + p.b.num_intervals));
+  state.counters["device_speedup"] = (device > 0.0) ? reference / device : 0.0;
+}
+
+static void BM_Reference_Intersect_RandomBoxes(benchmark::State& state) {
+  const auto n = static_cast<Coord>(state.range(0));
+  run_reference_intersect(state, cached_pair("ref_boxes/" + std::to_string(n),
+                                             gen::RandomBoxes{n, 16, 0.25, 1},
+                                             gen::RandomBoxes{n, 16, 0.25, 2}));
+}
+
+static void BM_Reference_Intersect_SphereShell(benchmark::State& state) {
+  const auto n = static_cast<Coord>(state.range(0));
+  const Coord r = n / 2;
+  run_reference_intersect(state, cached_pair("ref_sphere/" + std::to_string(n),
+                                             gen::SphereShell{r, r - r / 4, r},
+                                             gen::SphereShell{r + n / 8, r - r / 4, r}));
+}
+
+BENCHMARK(BM_Reference_Intersect_RandomBoxes)->Arg(128)->Arg(512);
+BENCHMARK(BM_Reference_Intersect_SphereShell)->Arg(64)->Arg(256);
+
+} // anonymous namespace
@@ -0,0 +1,65 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <Kokkos_Core.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+
+namespace {
+
+// ============================================================================
+// STREAM-like baselines: the memory roof the set operations are measured
+// against (GB/s counters have the same meaning as in the other benchmarks)
+// ============================================================================
+
+using Vector = Kokkos::View<double*>;
+
+void set_bandwidth(benchmark::State& state, std::size_t n, int arrays) {
+  const double bytes = static_cast<double>(n * sizeof(double)) * arrays;
+  state.counters["bytes"] = bytes;
+  state.counters["GB/s"] = benchmark::Counter(
+      bytes * static_cast<double>(state.iterations()) * 1e-9, benchmark::Counter::kIsRate);
+}
+
+// c = a
+static void BM_Stream_Copy(benchmark::State& state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  Vector a("stream_a", n);
+  Vector c("stream_c", n);
+  Kokkos::deep_copy(a, 1.0);
+
+  for (auto _ : state) {
+    Kokkos::parallel_for(
+        "stream_copy", n, KOKKOS_LAMBDA(const std::size_t i) { c(i) = a(i); });
+    Kokkos::fence("stream_copy");
+  }
+
+  set_bandwidth(state, n, 2);
+}
+
+// a = b + s * c
+static void BM_Stream_Triad(benchmark::State& state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  Vector a("stream_a", n);
+  Vector b("stream_b", n);
+  Vector c("stream_c", n);
+  Kokkos::deep_copy(b, 1.0);
+  Kokkos::deep_copy(c, 2.0);
+  const double s = 3.0;
+
+  for (auto _ : state) {
+    Kokkos::parallel_for(
+        "stream_triad", n, KOKKOS_LAMBDA(const std::size_t i) { a(i) = b(i) + s * c(i); });
+    Kokkos::fence("stream_triad");
+  }
+
+  set_bandwidth(state, n, 3);
+}
+
+// Sizes from cache-resident to well beyond last-level cache
+BENCHMARK(BM_Stream_Copy)->Arg(1 << 16)->Arg(1 << 22)->Arg(1 << 26)->UseRealTime();
+BENCHMARK(BM_Stream_Triad)->Arg(1 << 16)->Arg(1 << 22)->Arg(1 << 26)->UseRealTime();
+
+} // anonymous namespace
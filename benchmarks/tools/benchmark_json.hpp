@@ -0,0 +1,307 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <cctype>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace subsetix::bench::json {
+
+// ============================================================================
+// Minimal JSON reader for Google Benchmark output (--benchmark_out_format=json)
+// ============================================================================
+
+/**
+ * @brief JSON value: null, bool, number, string, array or object.
+ */
+struct Value {
+  enum class Type { Null, Bool, Number, String, Array, Object };
+
+  Type type = Type::Null;
+  bool boolean = false;
+  double number = 0.0;
+  std::string string;
+  std::vector<Value> array;
+  std::map<std::string, Value> object;
+
+  bool has(const std::string& key) const {
+    return type == Type::Object && object.count(key) > 0;
+  }
+
+  const Value& operator[](const std::string& key) const {
+    static const Value null_value;
+    if (type != Type::Object) {
+      return null_value;
+    }
+    const auto it = object.find(key);
+    return (it == object.end()) ? null_value : it->second;
+  }
+
+  double as_number(double fallback = 0.0) const {
+    return (type == Type::Number) ? number : fallback;
+  }
+
+  const std::string& as_string() const {
+    static const std::string empty;
+    return (type == Type::String) ? string : empty;
+  }
+};
+
+namespace detail {
+
+class Parser {
+public:
+  explicit Parser(const std::string& text) : s_(text) {}
+
+  Value parse() {
+    Value v = value();
+    skip_ws();
+    if (pos_ != s_.size()) {
+      fail("trailing characters");
+    }
+    return v;
+  }
+
+private:
+  [[noreturn]] void fail(const char* what) const {
+    throw std::runtime_error("json: " + std::string(what) + " at offset " +
+                             std::to_string(pos_));
+  }
+
+  void skip_ws() {
+    while (pos_ < s_.size() && std::isspace(static_cast<unsigned char>(s_[pos_]))) {
+      ++pos_;
+    }
+  }
+
+  char peek() {
+    skip_ws();
+    if (pos_ >= s_.size()) {
+      fail("unexpected end of input");
+    }
+    return s_[pos_];
+  }
+
+  void expect(char c) {
+    if (peek() != c) {
+      fail("unexpected character");
+    }
+    ++pos_;
+  }
+
+  bool consume(const char* word) {
+    const std::string w(word);
+    if (s_.compare(pos_, w.size(), w) == 0) {
+      pos_ += w.size();
+      return true;
+    }
+    return false;
+  }
+
+  Value value() {
+    const char c = peek();
+    Value v;
+    if (c == '{') {
+      v.type = Value::Type::Object;
+      ++pos_;
+      if (peek() == '}') {
+        ++pos_;
+        return v;
+      }
+      while (true) {
+        std::string key = string_literal();
+        expect(':');
+        v.object[std::move(key)] = value();
+        if (peek() == ',') {
+          ++pos_;
+          continue;
+        }
+        expect('}');
+        return v;
+      }
+    }
+    if (c == '[') {
+      v.type = Value::Type::Array;
+      ++pos_;
+      if (peek() == ']') {
+        ++pos_;
+        return v;
+      }
+      while (true) {
+        v.array.push_back(value());
+        if (peek() == ',') {
+          ++pos_;
+          continue;
+        }
+        expect(']');
+        return v;
+      }
+    }
+    if (c == '"') {
+      v.type = Value::Type::String;
+      v.string = string_literal();
+      return v;
+    }
+    if (consume("true")) {
+      v.type = Value::Type::Bool;
+      v.boolean = true;
+      return v;
+    }
+    if (consume("false")) {
+      v.type = Value::Type::Bool;
+      return v;
+    }
+    if (consume("null")) {
+      return v;
+    }
+    // Google Benchmark writes nan/inf as bare words for some counters
+    if (consume("NaN") || consume("nan") || consume("-nan")) {
+      v.type = Value::Type::Number;
+      v.number = std::numeric_limits<double>::quiet_NaN();
+      return v;
+    }
+    const char* begin = s_.c_str() + pos_;
+    char* end = nullptr;
+    v.number = std::strtod(begin, &end);
+    if (end == begin) {
+      fail("invalid value");
+    }
+    v.type = Value::Type::Number;
+    pos_ += static_cast<std::size_t>(end - begin);
+    return v;
+  }
+
+  std::string string_literal() {
+    expect('"');
+    std::string out;
+    while (pos_ < s_.size() && s_[pos_] != '"') {
+      char c = s_[pos_++];
+      if (c == '\\') {
+        if (pos_ >= s_.size()) {
+          break;
+        }
+        c = s_[pos_++];
+        switch (c) {
+          case 'n': out += '\n'; break;
+          case 't': out += '\t'; break;
+          case 'r': out += '\r'; break;
+          case 'b': out += '\b'; break;
+          case 'f': out += '\f'; break;
+          case 'u': {
+            // Benchmark names are ASCII; keep the code point only if it is
+            const unsigned long cp = std::strtoul(s_.substr(pos_, 4).c_str(), nullptr, 16);
+            out += (cp < 0x80) ? static_cast<char>(cp) : '?';
+            pos_ += 4;
+            break;
+          }
+          default: out += c; break;
+        }
+      } else {
+        out += c;
+      }
+    }
+    expect('"');
+    return out;
+  }
+
+  const std::string& s_;
+  std::size_t pos_ = 0;
+};
+
+} // namespace detail
+
+inline Value parse(const std::string& text) {
+  return detail::Parser(text).parse();
+}
+
+inline Value parse_file(const std::string& path) {
+  std::ifstream in(path);
+  if (!in) {
+    throw std::runtime_error("json: cannot open " + path);
+  }
+  std::ostringstream ss;
+  ss << in.rdbuf();
+  return parse(ss.str());
+}
+
+// ============================================================================
+// Google Benchmark runs
+// ============================================================================
+
+/**
+ * @brief One entry of the "benchmarks" array, times converted to seconds.
+ */
+struct Run {
+  std::string name;            // full name, e.g. "BM_Foo/64_median"
+  std::string run_name;        // name without the aggregate suffix
+  std::string aggregate_name;  // "mean", "median", "stddev", "cv" or empty
+  std::size_t repetition_index = 0;
+  double iterations = 0.0;
+  double real_time = 0.0;
+  double cpu_time = 0.0;
+  double items_per_second = 0.0;
+  std::map<std::string, double> counters;  // every other numeric field
+};
+
+inline double time_unit_scale(const std::string& unit) {
+  if (unit == "ns") return 1e-9;
+  if (unit == "us") return 1e-6;
+  if (unit == "ms") return 1e-3;
+  return 1.0;
+}
+
+/**
+ * @brief Extract the runs of a Google Benchmark JSON document.
+ *
+ * @throws std::runtime_error if the document has no "benchmarks" array
+ */
+inline std::vector<Run> read_runs(const Value& doc) {
+  const Value& list = doc["benchmarks"];
+  if (list.type != Value::Type::Array) {
+    throw std::runtime_error("json: no \"benchmarks\" array");
+  }
+  static const char* const known[] = {"name",          "run_name",   "run_type",
+                                      "aggregate_name", "repetitions", "repetition_index",
+                                      "threads",        "iterations", "real_time",
+                                      "cpu_time",       "time_unit",  "family_index",
+                                      "per_family_instance_index", "aggregate_unit"};
+  std::vector<Run> runs;
+  for (const Value& b : list.array) {
+    if (b["error_occurred"].type == Value::Type::Bool && b["error_occurred"].boolean) {
+      continue;
+    }
+    Run r;
+    r.name = b["name"].as_string();
+    r.run_name = b.has("run_name") ? b["run_name"].as_string() : r.name;
+    r.aggregate_name = b["aggregate_name"].as_string();
+    r.repetition_index = static_cast<std::size_t>(b["repetition_index"].as_number());
+    r.iterations = b["iterations"].as_number();
+    const double scale = time_unit_scale(b["time_unit"].as_string());
+    r.real_time = b["real_time"].as_number() * scale;
+    r.cpu_time = b["cpu_time"].as_number() * scale;
+    r.items_per_second = b["items_per_second"].as_number();
+    for (const auto& [key, v] : b.object) {
+      bool skip = (v.type != Value::Type::Number);
+      for (const char* k : known) {
+        skip = skip || (key == k);
+      }
+      if (!skip) {
+        r.counters[key] = v.number;
+      }
+    }
+    runs.push_back(std::move(r));
+  }
+  return runs;
+}
+
+} // namespace subsetix::bench::json
@@ -0,0 +1,222 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Regression check of a Google Benchmark JSON output against a baseline.
+//
+// Both files should come from subsetix_benchmark_main runs with
+// --benchmark_repetitions=N (N >= 5 gives non-trivial intervals) and
+// without --benchmark_report_aggregates_only. For every benchmark the tool
+// takes the median of the repetitions and its distribution-free confidence
+// interval (order statistics of the binomial distribution). A benchmark
+// regresses when its median time grows by more than the threshold AND the
+// two confidence intervals do not overlap, so noisy runs do not trip the
+// gate. With few repetitions no pair of order statistics reaches the
+// requested level (5 repetitions give at most 93.75%), so the coverage each
+// interval actually achieves is reported next to it. Files holding only
+// aggregates fall back to the reported median, without an interval.
+
+#include "benchmark_json.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+namespace json = subsetix::bench::json;
+
+struct Options {
+  std::string baseline;
+  std::string current;
+  double threshold = 0.05;   // relative change of the median
+  double confidence = 0.95;  // level of the median intervals
+  bool cpu_time = false;
+  bool fail = true;
+};
+
+// Median of the repetitions and its confidence interval, in seconds
+struct Summary {
+  std::size_t samples = 0;
+  double median = 0.0;
+  double lo = 0.0;
+  double hi = 0.0;
+  double coverage = 0.0;  // probability that [lo, hi] holds the true median
+};
+
+void usage(const char* argv0) {
+  std::cerr << "usage: " << argv0 << " [options] BASELINE.json CURRENT.json\n"
+            << "  --threshold=X   relative slowdown of the median to flag (default 0.05)\n"
+            << "  --confidence=X  confidence level of the median intervals (default 0.95)\n"
+            << "  --cpu-time      compare cpu_time instead of real_time\n"
+            << "  --no-fail       exit with 0 even if regressions are found\n";
+}
+
+Options parse_options(int argc, char** argv) {
+  Options opt;
+  std::vector<std::string> files;
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+    const auto eq = arg.find('=');
+    const std::string key = arg.substr(0, eq);
+    const std::string value = (eq == std::string::npos) ? std::string() : arg.substr(eq + 1);
+    if (key == "--threshold") {
+      opt.threshold = std::atof(value.c_str());
+    } else if (key == "--confidence") {
+      opt.confidence = std::atof(value.c_str());
+    } else if (key == "--cpu-time") {
+      opt.cpu_time = true;
+    } else if (key == "--no-fail") {
+      opt.fail = false;
+    } else if (arg.rfind("--", 0) == 0) {
+      throw std::invalid_argument("unknown option: " + arg);
+    } else {
+      files.push_back(arg);
+    }
+  }
+  if (files.size() != 2) {
+    throw std::invalid_argument("expected a baseline and a current file");
+  }
+  if (opt.threshold < 0.0 || opt.confidence <= 0.0 || opt.confidence >= 1.0) {
+    throw std::invalid_argument("threshold must be >= 0 and confidence in (0, 1)");
+  }
+  opt.baseline = files[0];
+  opt.current = files[1];
+  return opt;
+}
+
+// P(X <= k) for X ~ Binomial(n, 1/2)
+double binomial_cdf_half(std::size_t n, std::size_t k) {
+  double term = std::pow(0.5, static_cast<double>(n));  // C(n, 0) / 2^n
+  double sum = term;
+  for (std::size_t i = 1; i <= k; ++i) {
+    term *= static_cast<double>(n - i + 1) / static_cast<double>(i);
+    sum += term;
+  }
+  return sum;
+}
+
+Summary summarize(std::vector<double> x, double confidence) {
+  Summary s;
+  s.samples = x.size();
+  std::sort(x.begin(), x.end());
+  const std::size_t n = x.size();
+  s.median = (n % 2 == 1) ? x[n / 2] : 0.5 * (x[n / 2 - 1] + x[n / 2]);
+
+  // Largest k with P(X < k) <= alpha / 2: [x_(k), x_(n-k+1)] (1-based) then
+  // covers the median with probability >= confidence. When even k = 1 is too
+  // wide a step (small n), fall back to [min, max], which covers less
+  const double alpha = 1.0 - confidence;
+  std::size_t k = 0;
+  while (k + 1 <= n / 2 && binomial_cdf_half(n, k) <= alpha / 2) {
+    ++k;
+  }
+  const std::size_t lo = (k > 0) ? k - 1 : 0;  // 0-based x_(k), or the minimum
+  s.lo = x[lo];
+  s.hi = x[n - 1 - lo];
+  s.coverage = 1.0 - 2.0 * binomial_cdf_half(n, lo);
+  return s;
+}
+
+std::map<std::string, Summary> load(const std::string& path, const Options& opt) {
+  std::map<std::string, std::vector<double>> reps;
+  std::map<std::string, double> medians;
+  for (const json::Run& r : json::read_runs(json::parse_file(path))) {
+    const double t = opt.cpu_time ? r.cpu_time : r.real_time;
+    if (r.aggregate_name.empty()) {
+      reps[r.run_name].push_back(t);
+    } else if (r.aggregate_name == "median") {
+      medians[r.run_name] = t;
+    }
+  }
+  std::map<std::string, Summary> out;
+  for (const auto& [name, times] : reps) {
+    out[name] = summarize(times, opt.confidence);
+  }
+  for (const auto& [name, median] : medians) {
+    if (out.count(name) == 0) {
+      out[name] = Summary{1, median, median, median};
+    }
+  }
+  return out;
+}
+
+std::string format_ms(double seconds) {
+  std::ostringstream ss;
+  ss << std::fixed << std::setprecision(4) << 1e3 * seconds;
+  return ss.str();
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv) {
+  Options opt;
+  std::map<std::string, Summary> base;
+  std::map<std::string, Summary> cur;
+  try {
+    opt = parse_options(argc, argv);
+    base = load(opt.baseline, opt);
+    cur = load(opt.current, opt);
+  } catch (const std::exception& e) {
+    std::cerr << "subsetix_benchmark_compare: " << e.what() << '\n';
+    usage(argv[0]);
+    return 2;
+  }
+
+  std::cout << std::left << std::setw(52) << "benchmark" << std::right << std::setw(12)
+            << "base [ms]" << std::setw(12) << "cur [ms]" << std::setw(10) << "change"
+            << std::setw(26) << "cur interval [ms]" << std::setw(8) << "cov"
+            << "  verdict\n";
+
+  std::size_t regressions = 0;
+  std::size_t under_covered = 0;
+  for (const auto& [name, c] : cur) {
+    const auto it = base.find(name);
+    std::cout << std::left << std::setw(52) << name << std::right;
+    if (it == base.end()) {
+      std::cout << std::setw(12) << "-" << std::setw(12) << format_ms(c.median) << "  new\n";
+      continue;
+    }
+    const Summary& b = it->second;
+    if (b.coverage < opt.confidence || c.coverage < opt.confidence) {
+      ++under_covered;
+    }
+    const double change = (b.median > 0.0) ? c.median / b.median - 1.0 : 0.0;
+    const bool separated = (c.lo > b.hi) || (c.hi < b.lo);
+
+    const char* verdict = "~";
+    if (change > opt.threshold && separated) {
+      verdict = "REGRESSION";
+      ++regressions;
+    } else if (change < -opt.threshold && separated) {
+      verdict = "improved";
+    } else if (std::abs(change) > opt.threshold) {
+      verdict = "~ (noisy)";
+    }
+
+    std::cout << std::setw(12) << format_ms(b.median) << std::setw(12) << format_ms(c.median)
+              << std::setw(9) << std::fixed << std::setprecision(1) << 100.0 * change << '%'
+              << std::setw(26) << ("[" + format_ms(c.lo) + ", " + format_ms(c.hi) + "]")
+              << std::setw(7) << std::setprecision(1) << 100.0 * c.coverage << '%' << "  "
+              << verdict << '\n';
+  }
+  for (const auto& [name, b] : base) {
+    if (cur.count(name) == 0) {
+      std::cout << std::left << std::setw(52) << name << std::right << std::setw(12)
+                << format_ms(b.median) << std::setw(12) << "-" << "  missing\n";
+    }
+  }
+
+  std::cout << '\n' << regressions << " regression(s) above " << 100.0 * opt.threshold
+            << "% at " << 100.0 * opt.confidence << "% confidence\n";
+  if (under_covered > 0) {
+    std::cout << under_covered << " comparison(s) have too few repetitions for "
+              << 100.0 * opt.confidence << "% intervals; see the cov column\n";
+  }
+  return (opt.fail && regressions > 0) ? 1 : 0;
+}
@@ -0,0 +1,299 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Thread-scaling driver for subsetix_benchmark_main.
+//
+// Kokkos cannot be re-initialised with another thread count inside one
+// process, so the driver runs the benchmark binary once per thread count
+// (--kokkos-num-threads, OMP_NUM_THREADS), reads its JSON output and
+// reports, for every benchmark size, the median time, the speedup and the
+// parallel efficiency relative to the smallest thread count (strong
+// scaling). For each benchmark family it also pairs thread counts with the
+// size whose work grows by the same factor (weak scaling).
+
+#include "benchmark_json.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+namespace json = subsetix::bench::json;
+
+struct Options {
+  std::string exe;
+  std::vector<int> threads;
+  std::string filter = "^BM_(Intersect|Intersection)_";
+  int repetitions = 3;
+  std::string json_out;
+  std::string csv_out;
+};
+
+// One measurement: a benchmark instance at one thread count
+struct Sample {
+  std::string benchmark;  // e.g. "BM_Intersect_SphereShell/256"
+  std::string family;     // e.g. "BM_Intersect_SphereShell"
+  long long size = 0;     // first numeric argument, 0 if none
+  int threads = 0;
+  double seconds = 0.0;   // median real time per iteration
+  double items = 0.0;     // items per iteration, 0 if not reported
+};
+
+struct Row {
+  std::string kind;  // "strong" or "weak"
+  Sample sample;
+  double speedup = 0.0;
+  double efficiency = 0.0;
+};
+
+void usage(const char* argv0) {
+  std::cerr << "usage: " << argv0 << " [options]\n"
+            << "  --benchmark-exe=PATH  benchmark binary (default: subsetix_benchmark_main\n"
+            << "                        next to this driver)\n"
+            << "  --threads=LIST        comma-separated thread counts (default: powers of\n"
+            << "                        two up to the hardware concurrency)\n"
+            << "  --filter=REGEX        Google Benchmark filter (default: "
+            << Options{}.filter << ")\n"
+            << "  --repetitions=N       repetitions per run; the median is used (default 3)\n"
+            << "  --json=PATH           write the results as JSON\n"
+            << "  --csv=PATH            write the results as CSV\n";
+}
+
+std::vector<int> parse_list(const std::string& text) {
+  std::vector<int> out;
+  std::stringstream ss(text);
+  std::string item;
+  while (std::getline(ss, item, ',')) {
+    const int v = std::atoi(item.c_str());
+    if (v <= 0) {
+      throw std::invalid_argument("invalid thread count: " + item);
+    }
+    out.push_back(v);
+  }
+  return out;
+}
+
+Options parse_options(int argc, char** argv) {
+  Options opt;
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+    const auto eq = arg.find('=');
+    const std::string key = arg.substr(0, eq);
+    const std::string value = (eq == std::string::npos) ? std::string() : arg.substr(eq + 1);
+    if (key == "--benchmark-exe") {
+      opt.exe = value;
+    } else if (key == "--threads") {
+      opt.threads = parse_list(value);
+    } else if (key == "--filter") {
+      opt.filter = value;
+    } else if (key == "--repetitions") {
+      opt.repetitions = std::max(1, std::atoi(value.c_str()));
+    } else if (key == "--json") {
+      opt.json_out = value;
+    } else if (key == "--csv") {
+      opt.csv_out = value;
+    } else {
+      throw std::invalid_argument("unknown option: " + arg);
+    }
+  }
+  if (opt.exe.empty()) {
+    opt.exe = (std::filesystem::path(argv[0]).parent_path() / "subsetix_benchmark_main").string();
+  }
+  if (opt.threads.empty()) {
+    const int hw = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    for (int t = 1; t < hw; t *= 2) {
+      opt.threads.push_back(t);
+    }
+    opt.threads.push_back(hw);
+  }
+  std::sort(opt.threads.begin(), opt.threads.end());
+  opt.threads.erase(std::unique(opt.threads.begin(), opt.threads.end()), opt.threads.end());
+  return opt;
+}
+
+// "BM_Foo/256/real_time" -> family "BM_Foo", size 256
+void split_name(const std::string& name, std::string& family, long long& size) {
+  const auto slash = name.find('/');
+  family = name.substr(0, slash);
+  size = 0;
+  if (slash != std::string::npos) {
+    size = std::atoll(name.c_str() + slash + 1);
+  }
+}
+
+std::vector<Sample> run_benchmarks(const Options& opt, int threads) {
+  const auto out = std::filesystem::temp_directory_path() /
+                   ("subsetix_scaling_" + std::to_string(threads) + ".json");
+  std::ostringstream cmd;
+  cmd << "OMP_NUM_THREADS=" << threads << " \"" << opt.exe << "\""
+      << " --kokkos-num-threads=" << threads << " --benchmark_filter='" << opt.filter << "'"
+      << " --benchmark_repetitions=" << opt.repetitions
+      << " --benchmark_report_aggregates_only=true"
+      << " --benchmark_out=\"" << out.string() << "\" --benchmark_out_format=json"
+      << " > /dev/null";
+  std::cerr << "[scaling] " << threads << " thread(s)\n";
+  if (std::system(cmd.str().c_str()) != 0) {
+    throw std::runtime_error("benchmark run failed: " + cmd.str());
+  }
+
+  std::vector<Sample> samples;
+  for (const json::Run& r : json::read_runs(json::parse_file(out.string()))) {
+    // With repetitions only aggregates are reported; use their median
+    if (opt.repetitions > 1 && r.aggregate_name != "median") {
+      continue;
+    }
+    Sample s;
+    s.benchmark = r.run_name;
+    split_name(r.run_name, s.family, s.size);
+    s.threads = threads;
+    s.seconds = r.real_time;
+    s.items = r.items_per_second * r.real_time;
+    samples.push_back(s);
+  }
+  std::filesystem::remove(out);
+  return samples;
+}
+
+// Speedup and efficiency of every sample against the smallest thread count
+std::vector<Row> strong_scaling(const std::vector<Sample>& samples, int base_threads) {
+  std::map<std::string, double> base;
+  for (const Sample& s : samples) {
+    if (s.threads == base_threads) {
+      base[s.benchmark] = s.seconds;
+    }
+  }
+  std::vector<Row> rows;
+  for (const Sample& s : samples) {
+    const auto it = base.find(s.benchmark);
+    if (it == base.end() || s.seconds <= 0.0) {
+      continue;
+    }
+    Row row{"strong", s, it->second / s.seconds, 0.0};
+    row.efficiency = row.speedup * base_threads / s.threads;
+    rows.push_back(row);
+  }
+  return rows;
+}
+
+// For each family: the smallest-work size at the base thread count against,
+// at p threads, the size whose work is closest to p / base times larger.
+// Efficiency is normalised by the actual work ratio.
+std::vector<Row> weak_scaling(const std::vector<Sample>& samples, int base_threads) {
+  std::map<std::string, std::vector<const Sample*>> by_family;
+  for (const Sample& s : samples) {
+    if (s.items > 0.0 && s.seconds > 0.0) {
+      by_family[s.family].push_back(&s);
+    }
+  }
+  std::vector<Row> rows;
+  for (const auto& [family, list] : by_family) {
+    const Sample* base = nullptr;
+    for (const Sample* s : list) {
+      if (s->threads == base_threads && (!base || s->items < base->items)) {
+        base = s;
+      }
+    }
+    if (!base) {
+      continue;
+    }
+    std::map<int, std::pair<double, const Sample*>> best;  // threads -> (distance, sample)
+    for (const Sample* s : list) {
+      const double target = base->items * s->threads / base_threads;
+      const double d = std::abs(std::log(s->items / target));
+      const auto it = best.find(s->threads);
+      if (it == best.end() || d < it->second.first) {
+        best[s->threads] = {d, s};
+      }
+    }
+    for (const auto& [threads, entry] : best) {
+      const Sample* s = entry.second;
+      const double work = s->items / base->items;
+      Row row{"weak", *s, 0.0, 0.0};
+      row.speedup = work * base->seconds / s->seconds;  // throughput gain
+      row.efficiency = row.speedup * base_threads / threads;
+      rows.push_back(row);
+    }
+  }
+  return rows;
+}
+
+void write_csv(std::ostream& os, const std::vector<Row>& rows) {
+  os << "kind,benchmark,family,size,threads,seconds,items,speedup,efficiency\n";
+  for (const Row& r : rows) {
+    os << r.kind << ',' << r.sample.benchmark << ',' << r.sample.family << ',' << r.sample.size
+       << ',' << r.sample.threads << ',' << std::setprecision(9) << r.sample.seconds << ','
+       << r.sample.items << ',' << r.speedup << ',' << r.efficiency << '\n';
+  }
+}
+
+void write_json(std::ostream& os, const std::vector<Row>& rows) {
+  os << "{\n  \"results\": [\n";
+  for (std::size_t i = 0; i < rows.size(); ++i) {
+    const Row& r = rows[i];
+    os << "    {\"kind\": \"" << r.kind << "\", \"benchmark\": \"" << r.sample.benchmark
+       << "\", \"family\": \"" << r.sample.family << "\", \"size\": " << r.sample.size
+       << ", \"threads\": " << r.sample.threads << ", \"seconds\": " << std::setprecision(9)
+       << r.sample.seconds << ", \"items\": " << r.sample.items
+       << ", \"speedup\": " << r.speedup << ", \"efficiency\": " << r.efficiency << "}"
+       << (i + 1 < rows.size() ? "," : "") << '\n';
+  }
+  os << "  ]\n}\n";
+}
+
+void print_table(const std::vector<Row>& rows) {
+  std::cout << std::left << std::setw(8) << "kind" << std::setw(48) << "benchmark" << std::right
+            << std::setw(8) << "threads" << std::setw(14) << "time [ms]" << std::setw(10)
+            << "speedup" << std::setw(12) << "efficiency" << '\n';
+  for (const Row& r : rows) {
+    std::cout << std::left << std::setw(8) << r.kind << std::setw(48) << r.sample.benchmark
+              << std::right << std::setw(8) << r.sample.threads << std::fixed
+              << std::setprecision(3) << std::setw(14) << 1e3 * r.sample.seconds
+              << std::setprecision(2) << std::setw(10) << r.speedup << std::setw(12)
+              << r.efficiency << '\n';
+  }
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv) {
+  try {
+    const Options opt = parse_options(argc, argv);
+
+    std::vector<Sample> samples;
+    for (const int t : opt.threads) {
+      const std::vector<Sample> run = run_benchmarks(opt, t);
+      samples.insert(samples.end(), run.begin(), run.end());
+    }
+
+    std::vector<Row> rows = strong_scaling(samples, opt.threads.front());
+    const std::vector<Row> weak = weak_scaling(samples, opt.threads.front());
+    rows.insert(rows.end(), weak.begin(), weak.end());
+
+    print_table(rows);
+    if (!opt.json_out.empty()) {
+      std::ofstream out(opt.json_out);
+      write_json(out, rows);
+    }
+    if (!opt.csv_out.empty()) {
+      std::ofstream out(opt.csv_out);
+      write_csv(out, rows);
+    }
+  } catch (const std::exception& e) {
+    std::cerr << "subsetix_scaling_driver: " << e.what() << '\n';
+    usage(argv[0]);
+    return 1;
+  }
+  return 0;
+}
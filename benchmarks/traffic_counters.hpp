@@ -0,0 +1,128 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/field.hpp>
+#include <subsetix/profiling.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <Kokkos_Core.hpp>
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace subsetix::bench {
+
+/**
+ * @brief Bytes moved by one phase of an operation.
+ */
+struct PhaseTraffic {
+  const char* phase;
+  double bytes_read = 0.0;
+  double bytes_written = 0.0;
+
+  double bytes() const { return bytes_read + bytes_written; }
+};
+
+/**
+ * @brief Traffic model of intersect_meshes(A, B) = R, one entry per phase.
+ *
+ * Every buffer access pass is counted once at its element size; each
+ * binary search over B's rows reads log2(rows of B) keys. The rows of R
+ * stand in for the matched rows and the intervals of matched rows are taken
+ * in proportion, so the model is an estimate (a lower bound when compaction
+ * drops rows, which is also why compact_copy is not modelled).
+ */
+inline std::vector<PhaseTraffic> intersection_traffic(const Mesh3DDevice& A,
+                                                      const Mesh3DDevice& B,
+                                                      const Mesh3DDevice& R) {
+  constexpr double key = sizeof(RowKey);
+  constexpr double idx = sizeof(std::size_t);
+  constexpr double flag = sizeof(int);
+  constexpr double iv = sizeof(Interval);
+
+  const double na = static_cast<double>(A.num_rows);
+  const double nb = static_cast<double>(B.num_rows);
+  const double n = static_cast<double>(R.num_rows);
+  const double ia = (na > 0) ? static_cast<double>(A.num_intervals) * n / na : 0.0;
+  const double ib = (nb > 0) ? static_cast<double>(B.num_intervals) * n / nb : 0.0;
+  const double merge_read = n * (2 * flag + 4 * idx) + iv * (ia + ib);
+
+  return {
+      {"row_map", na * key * (1.0 + std::log2(nb + 1.0)), na * 3 * flag},
+      {"row_scan", na * flag, na * idx},
+      {"row_compact", na * flag + n * (idx + key + 2 * flag) + n * key, n * (2 * key + 2 * flag)},
+      {"count", merge_read, n * idx},
+      {"scan", n * idx, (n + 1) * idx},
+      {"fill", merge_read, iv * static_cast<double>(R.num_intervals)},
+      {"mark", (n + 1) * idx + n * flag, n * (flag + idx)},
+  };
+}
+
+inline double total_bytes(const std::vector<PhaseTraffic>& traffic) {
+  double total = 0.0;
+  for (const PhaseTraffic& p : traffic) {
+    total += p.bytes();
+  }
+  return total;
+}
+
+/**
+ * @brief Export achieved bandwidth and cell throughput of a timed loop.
+ *
+ * Counters: bytes (modelled traffic per iteration), GB/s and cells/s,
+ * both rates over the measured time. Compare GB/s with BM_Stream_* from
+ * the same binary to see how far the operation is from the memory roof.
+ */
+inline void report_bandwidth(benchmark::State& state,
+                             const std::vector<PhaseTraffic>& traffic,
+                             double cells) {
+  const double bytes = total_bytes(traffic);
+  const auto iterations = static_cast<double>(state.iterations());
+  state.counters["bytes"] = bytes;
+  state.counters["GB/s"] =
+      benchmark::Counter(bytes * iterations * 1e-9, benchmark::Counter::kIsRate);
+  state.counters["cells/s"] = benchmark::Counter(cells * iterations, benchmark::Counter::kIsRate);
+}
+
+/**
+ * @brief Per-phase GB/s from one extra run under the built-in Collector.
+ *
+ * Only available in builds with SUBSETIX_ENABLE_PROFILING; otherwise no
+ * counter is added. Call after the timing loop: the Collector fences every
+ * phase, which would perturb the measured time.
+ */
+template <class Op>
+void report_phase_bandwidth(benchmark::State& state,
+                            const char* operation,
+                            const std::vector<PhaseTraffic>& traffic,
+                            Op&& op) {
+  if constexpr (profiling::collector_available) {
+    auto& collector = profiling::Collector::instance();
+    collector.reset();
+    collector.enable();
+    op();
+    collector.disable();
+
+    const auto& phases = collector.phases();
+    for (const PhaseTraffic& p : traffic) {
+      const auto it = phases.find(std::string(operation) + "/" + p.phase);
+      if (it == phases.end() || it->second.seconds <= 0.0) {
+        continue;
+      }
+      state.counters[std::string("GB/s_") + p.phase] = p.bytes() * 1e-9 / it->second.seconds;
+    }
+    collector.reset();
+  } else {
+    (void)state;
+    (void)operation;
+    (void)traffic;
+    (void)op;
+  }
+}
+
+} // namespace subsetix::bench
@@ -0,0 +1,210 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/detail/utils.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace subsetix {
+
+/**
+ * @brief Many independent meshes stored in one set of flat CSR arrays.
+ *
+ * Mesh m owns rows [mesh_row_ptr(m), mesh_row_ptr(m+1)); row_ptr holds
+ * global offsets into intervals, so a kernel over all rows or all
+ * intervals covers every mesh in a single launch.
+ *
+ * Invariants:
+ * - mesh_row_ptr.extent(0) == num_meshes + 1, mesh_row_ptr(num_meshes) == num_rows
+ * - row_ptr(num_rows) == num_intervals
+ * - rows of each mesh are sorted; the Mesh3D invariants hold per mesh
+ */
+template <class MemorySpace>
+struct MeshBatch {
+  using RowKeyView = typename Mesh3D<MemorySpace>::RowKeyView;
+  using IndexView = Kokkos::View<std::size_t*, MemorySpace>;
+  using IntervalView = typename Mesh3D<MemorySpace>::IntervalView;
+
+  RowKeyView row_keys;     // [num_rows] - rows of all meshes, mesh by mesh
+  IndexView row_ptr;       // [num_rows + 1] - global CSR offsets
+  IntervalView intervals;  // [num_intervals] - X-intervals of all meshes
+  IndexView mesh_row_ptr;  // [num_meshes + 1] - row range of each mesh
+
+  std::size_t num_meshes = 0;
+  std::size_t num_rows = 0;
+  std::size_t num_intervals = 0;
+};
+
+using MeshBatchDevice = MeshBatch<Kokkos::DefaultExecutionSpace::memory_space>;
+
+namespace detail {
+
+// Raw CSR pointers of one mesh, gathered by make_batch in a single kernel
+struct MeshArrays {
+  const RowKey* row_keys = nullptr;
+  const std::size_t* row_ptr = nullptr;
+  const Interval* intervals = nullptr;
+};
+
+} // namespace detail
+
+/**
+ * @brief Pack meshes into one batch.
+ *
+ * Rows and intervals are gathered by one kernel each, whatever the number
+ * of meshes.
+ */
+template <class ExecSpace, class MemorySpace>
+MeshBatch<MemorySpace> make_batch(const ExecSpace& exec,
+                                  const std::vector<Mesh3D<MemorySpace>>& meshes) {
+  using Batch = MeshBatch<MemorySpace>;
+
+  Batch out;
+  out.num_meshes = meshes.size();
+
+  // Mesh ranges and raw pointers (host)
+  Kokkos::View<detail::MeshArrays*, Kokkos::HostSpace> arrays_host("batch_arrays", meshes.size());
+  Kokkos::View<std::size_t*, Kokkos::HostSpace> rows_host("batch_mesh_rows", meshes.size() + 1);
+  Kokkos::View<std::size_t*, Kokkos::HostSpace> ivs_host("batch_mesh_intervals",
+                                                         meshes.size() + 1);
+  for (std::size_t m = 0; m < meshes.size(); ++m) {
+    const auto& mesh = meshes[m];
+    arrays_host(m) = {mesh.row_keys.data(), mesh.row_ptr.data(), mesh.intervals.data()};
+    rows_host(m + 1) = rows_host(m) + mesh.num_rows;
+    ivs_host(m + 1) = ivs_host(m) + mesh.num_intervals;
+  }
+  out.num_rows = rows_host(meshes.size());
+  out.num_intervals = ivs_host(meshes.size());
+
+  Kokkos::View<detail::MeshArrays*, MemorySpace> arrays(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "batch_arrays"), meshes.size());
+  typename Batch::IndexView mesh_interval_ptr(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "batch_mesh_interval_ptr"),
+      meshes.size() + 1);
+  out.mesh_row_ptr = typename Batch::IndexView(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "batch_mesh_row_ptr"),
+      meshes.size() + 1);
+  Kokkos::deep_copy(exec, arrays, arrays_host);
+  Kokkos::deep_copy(exec, out.mesh_row_ptr, rows_host);
+  Kokkos::deep_copy(exec, mesh_interval_ptr, ivs_host);
+
+  out.row_keys = typename Batch::RowKeyView(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "batch_row_keys"), out.num_rows);
+  out.row_ptr = typename Batch::IndexView(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "batch_row_ptr"), out.num_rows + 1);
+  out.intervals = typename Batch::IntervalView(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "batch_intervals"),
+      out.num_intervals);
+
+  const std::size_t num_meshes = meshes.size();
+  const std::size_t num_rows = out.num_rows;
+  const std::size_t num_intervals = out.num_intervals;
+  auto mesh_row_ptr = out.mesh_row_ptr;
+  auto row_keys = out.row_keys;
+  auto row_ptr = out.row_ptr;
+  auto intervals = out.intervals;
+
+  Kokkos::parallel_for(
+      "batch_gather_rows",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, num_rows + 1),
+      KOKKOS_LAMBDA(const std::size_t i) {
+        if (i == num_rows) {
+          row_ptr(i) = num_intervals;
+          return;
+        }
+        const std::size_t m = detail::find_segment(mesh_row_ptr, num_meshes, i);
+        const std::size_t local = i - mesh_row_ptr(m);
+        row_keys(i) = arrays(m).row_keys[local];
+        row_ptr(i) = mesh_interval_ptr(m) + arrays(m).row_ptr[local];
+      });
+
+  Kokkos::parallel_for(
+      "batch_gather_intervals",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, num_intervals),
+      KOKKOS_LAMBDA(const std::size_t k) {
+        const std::size_t m = detail::find_segment(mesh_interval_ptr, num_meshes, k);
+        intervals(k) = arrays(m).intervals[k - mesh_interval_ptr(m)];
+      });
+
+  // The host staging views must outlive the asynchronous copies
+  exec.fence("batch_gather");
+  return out;
+}
+
+template <class MemorySpace>
+MeshBatch<MemorySpace> make_batch(const std::vector<Mesh3D<MemorySpace>>& meshes) {
+  return make_batch(typename MemorySpace::execution_space(), meshes);
+}
+
+/**
+ * @brief Copy mesh m of a batch out as a standalone Mesh3D.
+ *
+ * All work is enqueued on exec.
+ *
+ * @throws std::out_of_range if m >= batch.num_meshes
+ */
+template <class ExecSpace, class MemorySpace>
+Mesh3D<MemorySpace> unbatch(const ExecSpace& exec,
+                            const MeshBatch<MemorySpace>& batch,
+                            std::size_t m) {
+  using MeshType = Mesh3D<MemorySpace>;
+
+  if (m >= batch.num_meshes) {
+    throw std::out_of_range("subsetix::unbatch: mesh index out of range");
+  }
+
+  std::size_t first_row = 0;
+  std::size_t end_row = 0;
+  Kokkos::deep_copy(exec, first_row, Kokkos::subview(batch.mesh_row_ptr, m));
+  Kokkos::deep_copy(exec, end_row, Kokkos::subview(batch.mesh_row_ptr, m + 1));
+  exec.fence("unbatch_rows");
+  const std::size_t n = end_row - first_row;
+  if (n == 0) {
+    return MeshType{};
+  }
+
+  std::size_t first_interval = 0;
+  std::size_t last_interval = 0;
+  Kokkos::deep_copy(exec, first_interval, Kokkos::subview(batch.row_ptr, first_row));
+  Kokkos::deep_copy(exec, last_interval, Kokkos::subview(batch.row_ptr, first_row + n));
+  exec.fence("unbatch_intervals");
+
+  MeshType out;
+  out.num_rows = n;
+  out.num_intervals = last_interval - first_interval;
+  out.row_keys = typename MeshType::RowKeyView(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "mesh_row_keys"), n);
+  out.row_ptr = typename MeshType::IndexView(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "mesh_row_ptr"), n + 1);
+  out.intervals = typename MeshType::IntervalView(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "mesh_intervals"), out.num_intervals);
+
+  Kokkos::deep_copy(exec, out.row_keys,
+                    Kokkos::subview(batch.row_keys, std::make_pair(first_row, first_row + n)));
+  Kokkos::deep_copy(exec, out.intervals,
+                    Kokkos::subview(batch.intervals,
+                                    std::make_pair(first_interval, last_interval)));
+
+  auto src_ptr = batch.row_ptr;
+  auto dst_ptr = out.row_ptr;
+  Kokkos::parallel_for(
+      "unbatch_row_ptr",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, n + 1),
+      KOKKOS_LAMBDA(const std::size_t i) { dst_ptr(i) = src_ptr(first_row + i) - first_interval; });
+
+  return out;
+}
+
+template <class MemorySpace>
+Mesh3D<MemorySpace> unbatch(const MeshBatch<MemorySpace>& batch, std::size_t m) {
+  return unbatch(typename MemorySpace::execution_space(), batch, m);
+}
+
+} // namespace subsetix
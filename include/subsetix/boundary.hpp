@@ -0,0 +1,274 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/profiling.hpp>
+#include <subsetix/detail/utils.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+namespace subsetix {
+namespace detail {
+
+// ============================================================================
+// Per-row boundary extraction
+// ============================================================================
+
+/**
+ * @brief Boundary cells of the rows of a mesh.
+ *
+ * A cell (x, y, z) is interior when, for every row (y + dy, z + dz) of its
+ * neighbourhood, the x range [x - w, x + w] lies in that row, with w the x
+ * reach of the connectivity in that row:
+ *
+ *   row offset       Face  Edge  Vertex
+ *   own row (0, 0)    1     1     1
+ *   face rows         0     1     1
+ *   diagonal rows     -     0     1
+ *
+ * The interior of a row is thus the intersection of its neighbour rows
+ * eroded by w along x, and its boundary the own intervals minus that
+ * intersection. Runs of touching intervals count as one x range.
+ */
+template <class MemorySpace>
+struct BoundaryRows {
+  static constexpr int max_rows = 9;
+
+  Mesh3D<MemorySpace> mesh;
+  Connectivity connectivity = Connectivity::Face;
+
+  // Eroded run [begin, end) of row r holding the first interval ending after
+  // x + w; false if there is none. Empty runs give begin >= end.
+  KOKKOS_INLINE_FUNCTION
+  bool next_run(std::size_t r, std::int64_t w, std::int64_t x,
+                std::int64_t& begin, std::int64_t& end) const {
+    const std::size_t row_begin = mesh.row_ptr(r);
+    const std::size_t row_end = mesh.row_ptr(r + 1);
+    std::size_t lo = row_begin;
+    std::size_t hi = row_end;
+    while (lo < hi) {
+      const std::size_t mid = lo + (hi - lo) / 2;
+      if (mesh.intervals(mid).end <= x + w) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    if (lo == row_end) {
+      return false;
+    }
+    std::size_t first = lo;
+    while (first > row_begin && mesh.intervals(first - 1).end == mesh.intervals(first).begin) {
+      --first;
+    }
+    std::size_t last = lo;
+    while (last + 1 < row_end && mesh.intervals(last).end == mesh.intervals(last + 1).begin) {
+      ++last;
+    }
+    begin = static_cast<std::int64_t>(mesh.intervals(first).begin) + w;
+    end = static_cast<std::int64_t>(mesh.intervals(last).end) - w;
+    return true;
+  }
+
+  /**
+   * @brief First interior segment [begin, end) with end > x (leapfrog over
+   *        the eroded neighbour rows).
+   */
+  KOKKOS_INLINE_FUNCTION
+  bool next_interior(const std::size_t* rows, const std::int64_t* widths, int num_rows,
+                     std::int64_t x, std::int64_t& begin, std::int64_t& end) const {
+    begin = x;
+    while (true) {
+      bool moved = false;
+      end = std::numeric_limits<std::int64_t>::max();
+      for (int j = 0; j < num_rows; ++j) {
+        std::int64_t b = 0;
+        std::int64_t e = 0;
+        if (!next_run(rows[j], widths[j], begin, b, e)) {
+          return false;
+        }
+        if (b > begin) {
+          begin = b;  // every row must cover begin: restart from there
+          moved = true;
+          break;
+        }
+        end = (e < end) ? e : end;
+      }
+      if (!moved) {
+        return true;
+      }
+    }
+  }
+
+  /**
+   * @brief Count (CountOnly) or write from out(pos) the boundary of row r.
+   */
+  template <bool CountOnly, class IntervalViewOut>
+  KOKKOS_INLINE_FUNCTION
+  std::size_t row(std::size_t r, const IntervalViewOut& out, std::size_t pos) const {
+    const std::int64_t face_w = (connectivity == Connectivity::Face) ? 0 : 1;
+    const std::int64_t diagonal_w = (connectivity == Connectivity::Vertex) ? 1 : 0;
+    const int num_offsets = (connectivity == Connectivity::Face) ? 4 : 8;
+    const int dys[8] = {-1, 1, 0, 0, -1, -1, 1, 1};
+    const int dzs[8] = {0, 0, -1, 1, -1, 1, -1, 1};
+
+    // Rows the interior test reads; a missing one makes the whole row boundary
+    std::size_t rows[max_rows];
+    std::int64_t widths[max_rows];
+    rows[0] = r;
+    widths[0] = 1;
+    int num_rows = 1;
+    const RowKey key = mesh.row_keys(r);
+    bool closed = true;
+    for (int d = 0; d < num_offsets && closed; ++d) {
+      const std::int64_t y = static_cast<std::int64_t>(key.y) + dys[d];
+      const std::int64_t z = static_cast<std::int64_t>(key.z) + dzs[d];
+      const bool in_range = y >= std::numeric_limits<Coord>::min() &&
+                            y <= std::numeric_limits<Coord>::max() &&
+                            z >= std::numeric_limits<Coord>::min() &&
+                            z <= std::numeric_limits<Coord>::max();
+      const int nb = in_range ? find_row_by_yz(mesh.row_keys, mesh.num_rows,
+                                               static_cast<Coord>(y), static_cast<Coord>(z))
+                              : -1;
+      if (nb < 0) {
+        closed = false;
+      } else {
+        rows[num_rows] = static_cast<std::size_t>(nb);
+        widths[num_rows] = (d < 4) ? face_w : diagonal_w;
+        ++num_rows;
+      }
+    }
+
+    std::size_t count = 0;
+    for (std::size_t k = mesh.row_ptr(r); k < mesh.row_ptr(r + 1); ++k) {
+      const Interval iv = mesh.intervals(k);
+      if (!closed) {
+        if constexpr (!CountOnly) {
+          out(pos + count) = iv;
+        }
+        ++count;
+        continue;
+      }
+
+      // Gaps between the interior segments that meet iv
+      std::int64_t x = iv.begin;
+      while (x < iv.end) {
+        std::int64_t begin = 0;
+        std::int64_t end = 0;
+        const bool found = next_interior(rows, widths, num_rows, x, begin, end);
+        const std::int64_t gap_end = (found && begin < iv.end) ? begin : iv.end;
+        if (gap_end > x) {
+          if constexpr (!CountOnly) {
+            out(pos + count) = Interval{static_cast<Coord>(x), static_cast<Coord>(gap_end)};
+          }
+          ++count;
+        }
+        x = (found && begin < iv.end) ? end : iv.end;
+      }
+    }
+    return count;
+  }
+};
+
+} // namespace detail
+
+// ============================================================================
+// Boundary
+// ============================================================================
+
+/**
+ * @brief Cells of a mesh with at least one neighbour outside it.
+ *
+ * Equals mesh minus its erosion by the connectivity, but computed in one
+ * count / scan / fill pipeline over the rows of the mesh: x boundaries come
+ * from the interval endpoints, y / z boundaries from the neighbour rows
+ * (see detail::BoundaryRows). A row whose neighbour row is missing is
+ * boundary as a whole.
+ *
+ * Every row of the mesh holds at least one boundary cell (the first cell of
+ * its first interval), so the result has the row keys of mesh. Intervals
+ * are split but never merged: each output interval lies in one interval of
+ * mesh.
+ *
+ * @param exec Execution space instance the kernels are enqueued on
+ * @param mesh Input mesh
+ * @param connectivity Neighbourhood of a cell (default: faces)
+ * @return Boundary cells of mesh
+ */
+template <class ExecSpace, class MemorySpace>
+Mesh3D<MemorySpace> boundary(const ExecSpace& exec,
+                             const Mesh3D<MemorySpace>& mesh,
+                             Connectivity connectivity = Connectivity::Face) {
+  using MeshType = Mesh3D<MemorySpace>;
+  using IndexView = Kokkos::View<std::size_t*, MemorySpace>;
+  using Region = profiling::ScopedRegion<ExecSpace>;
+  static_assert(Kokkos::SpaceAccessibility<ExecSpace, MemorySpace>::accessible,
+                "boundary: execution space cannot access the mesh memory space");
+
+  const Region op_region(exec, "boundary");
+
+  const std::size_t n = mesh.num_rows;
+  if (n == 0) {
+    return MeshType{};
+  }
+  const detail::BoundaryRows<MemorySpace> rows{mesh, connectivity};
+
+  // Phase 1: Count boundary intervals per row
+  IndexView counts;
+  {
+    const Region region(exec, "count");
+    counts = IndexView(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "boundary_counts"), n);
+    Kokkos::parallel_for(
+        "boundary_count",
+        Kokkos::RangePolicy<ExecSpace>(exec, 0, n),
+        KOKKOS_LAMBDA(const std::size_t i) {
+          counts(i) = rows.template row<true>(i, typename MeshType::IntervalView(), 0);
+        });
+  }
+
+  // Phase 2: CSR offsets
+  MeshType out;
+  out.num_rows = n;
+  {
+    const Region region(exec, "scan");
+    out.row_keys = typename MeshType::RowKeyView(
+        Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "mesh_row_keys"), n);
+    Kokkos::deep_copy(exec, out.row_keys,
+                      Kokkos::subview(mesh.row_keys, std::make_pair(std::size_t(0), n)));
+    out.row_ptr = typename MeshType::IndexView(Kokkos::view_alloc(exec, "mesh_row_ptr"), n + 1);
+    out.num_intervals = detail::exclusive_scan_csr_row_ptr<std::size_t>(
+        exec, "boundary_scan", n, counts, out.row_ptr);
+  }
+
+  // Phase 3: Fill boundary intervals
+  {
+    const Region region(exec, "fill");
+    out.intervals = typename MeshType::IntervalView(
+        Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "mesh_intervals"),
+        out.num_intervals);
+    auto out_ptr = out.row_ptr;
+    auto out_intervals = out.intervals;
+    Kokkos::parallel_for(
+        "boundary_fill",
+        Kokkos::RangePolicy<ExecSpace>(exec, 0, n),
+        KOKKOS_LAMBDA(const std::size_t i) {
+          rows.template row<false>(i, out_intervals, out_ptr(i));
+        });
+  }
+
+  return out;
+}
+
+template <class MemorySpace>
+Mesh3D<MemorySpace> boundary(const Mesh3D<MemorySpace>& mesh,
+                             Connectivity connectivity = Connectivity::Face) {
+  return boundary(typename MemorySpace::execution_space(), mesh, connectivity);
+}
+
+} // namespace subsetix
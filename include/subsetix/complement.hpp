@@ -0,0 +1,229 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/profiling.hpp>
+#include <subsetix/detail/utils.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace subsetix {
+namespace detail {
+
+/**
+ * @brief Gaps of a row inside [lo, hi): count them (CountOnly) or write them
+ *        from out(pos).
+ *
+ * Intervals of the row are sorted and disjoint; touching intervals leave no
+ * gap between them.
+ */
+template <bool CountOnly, class IntervalViewIn, class IntervalViewOut>
+KOKKOS_INLINE_FUNCTION
+std::size_t row_gaps(const IntervalViewIn& intervals, std::size_t begin, std::size_t end,
+                     Coord lo, Coord hi, const IntervalViewOut& out, std::size_t pos) {
+  // First interval ending after lo
+  std::size_t k = begin;
+  std::size_t last = end;
+  while (k < last) {
+    const std::size_t mid = k + (last - k) / 2;
+    if (intervals(mid).end <= lo) {
+      k = mid + 1;
+    } else {
+      last = mid;
+    }
+  }
+
+  std::size_t count = 0;
+  Coord x = lo;
+  for (; k < end && intervals(k).begin < hi; ++k) {
+    const Interval iv = intervals(k);
+    if (iv.begin > x) {
+      if constexpr (!CountOnly) {
+        out(pos + count) = Interval{x, iv.begin};
+      }
+      ++count;
+    }
+    x = (iv.end > x) ? iv.end : x;
+  }
+  if (x < hi) {
+    if constexpr (!CountOnly) {
+      out(pos + count) = Interval{x, hi};
+    }
+    ++count;
+  }
+  return count;
+}
+
+} // namespace detail
+
+// ============================================================================
+// Complement within a box
+// ============================================================================
+
+/**
+ * @brief Cells of a box that are not in a mesh.
+ *
+ * Every row (y, z) of the box is visited once: rows of the mesh contribute
+ * the gaps of their intervals clipped to the x range of the box, rows missing
+ * from the mesh a single full-width interval. Cells of the mesh outside the
+ * box are ignored.
+ *
+ * Algorithm:
+ * 1. Count - gap intervals per box row (one binary search per row)
+ * 2. Compact - keep box rows with at least one gap
+ * 3. Scan - exact CSR offsets
+ * 4. Fill - write the gaps
+ * The box rows are enumerated in (y, z) order, so the output rows are sorted
+ * without a sort. The dense box mesh is never built.
+ *
+ * @param exec Execution space instance the kernels are enqueued on
+ * @param mesh Input mesh
+ * @param box Box the complement is taken in (empty box: empty result)
+ * @return box minus mesh
+ */
+template <class ExecSpace, class MemorySpace>
+Mesh3D<MemorySpace> complement(const ExecSpace& exec,
+                               const Mesh3D<MemorySpace>& mesh,
+                               const CellBox& box) {
+  using MeshType = Mesh3D<MemorySpace>;
+  using IndexView = Kokkos::View<std::size_t*, MemorySpace>;
+  using Region = profiling::ScopedRegion<ExecSpace>;
+  static_assert(Kokkos::SpaceAccessibility<ExecSpace, MemorySpace>::accessible,
+                "complement: execution space cannot access the mesh memory space");
+
+  const Region op_region(exec, "complement");
+
+  if (box.empty()) {
+    return MeshType{};
+  }
+
+  const Coord y0 = box.lo[1];
+  const Coord z0 = box.lo[2];
+  const Coord x_lo = box.lo[0];
+  const Coord x_hi = box.hi[0];
+  const std::size_t nz = static_cast<std::size_t>(static_cast<std::int64_t>(box.hi[2]) - z0);
+  const std::size_t n = static_cast<std::size_t>(static_cast<std::int64_t>(box.hi[1]) - y0) * nz;
+
+  auto rows = mesh.row_keys;
+  auto row_ptr = mesh.row_ptr;
+  auto intervals = mesh.intervals;
+  const std::size_t num_rows = mesh.num_rows;
+
+  // Phase 1: Count gaps per box row
+  IndexView counts;
+  IndexView mesh_row;  // row of the mesh at a box row, or num_rows
+  {
+    const Region region(exec, "count");
+    counts = IndexView(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "complement_counts"),
+                       n);
+    mesh_row = IndexView(
+        Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "complement_mesh_row"), n);
+    Kokkos::parallel_for(
+        "complement_count",
+        Kokkos::RangePolicy<ExecSpace>(exec, 0, n),
+        KOKKOS_LAMBDA(const std::size_t b) {
+          const Coord y = static_cast<Coord>(y0 + static_cast<std::int64_t>(b / nz));
+          const Coord z = static_cast<Coord>(z0 + static_cast<std::int64_t>(b % nz));
+          const int r = detail::find_row_by_yz(rows, num_rows, y, z);
+          if (r < 0) {
+            mesh_row(b) = num_rows;
+            counts(b) = 1;
+            return;
+          }
+          const std::size_t i = static_cast<std::size_t>(r);
+          mesh_row(b) = i;
+          counts(b) = detail::row_gaps<true>(intervals, row_ptr(i), row_ptr(i + 1), x_lo, x_hi,
+                                             typename MeshType::IntervalView(), 0);
+        });
+  }
+
+  // Phase 2: Compact box rows with at least one gap
+  IndexView kept;
+  std::size_t m = 0;
+  {
+    const Region region(exec, "row_scan");
+    kept = IndexView(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "complement_kept"), n);
+    Kokkos::View<std::size_t, MemorySpace> num_kept_view(
+        Kokkos::view_alloc(exec, "complement_num_kept"));
+    Kokkos::parallel_scan(
+        "complement_row_scan",
+        Kokkos::RangePolicy<ExecSpace>(exec, 0, n),
+        KOKKOS_LAMBDA(const std::size_t b, std::size_t& update, const bool final_pass) {
+          const std::size_t flag = (counts(b) > 0) ? 1 : 0;
+          if (final_pass) {
+            if (flag) {
+              kept(update) = b;
+            }
+            if (b + 1 == n) {
+              num_kept_view() = update + flag;
+            }
+          }
+          update += flag;
+        });
+    Kokkos::deep_copy(exec, m, num_kept_view);
+    exec.fence("complement_row_scan");
+  }
+
+  if (m == 0) {
+    return MeshType{};
+  }
+
+  // Phase 3: Row keys and exact CSR offsets
+  MeshType out;
+  out.num_rows = m;
+  {
+    const Region region(exec, "scan");
+    out.row_keys = typename MeshType::RowKeyView(
+        Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "mesh_row_keys"), m);
+    out.row_ptr = typename MeshType::IndexView(Kokkos::view_alloc(exec, "mesh_row_ptr"), m + 1);
+    IndexView kept_counts(
+        Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "complement_kept_counts"), m);
+    auto out_keys = out.row_keys;
+    Kokkos::parallel_for(
+        "complement_row_compact",
+        Kokkos::RangePolicy<ExecSpace>(exec, 0, m),
+        KOKKOS_LAMBDA(const std::size_t j) {
+          const std::size_t b = kept(j);
+          out_keys(j) = RowKey{static_cast<Coord>(y0 + static_cast<std::int64_t>(b / nz)),
+                               static_cast<Coord>(z0 + static_cast<std::int64_t>(b % nz))};
+          kept_counts(j) = counts(b);
+        });
+    out.num_intervals = detail::exclusive_scan_csr_row_ptr<std::size_t>(
+        exec, "complement_scan", m, kept_counts, out.row_ptr);
+  }
+
+  // Phase 4: Fill gaps
+  {
+    const Region region(exec, "fill");
+    out.intervals = typename MeshType::IntervalView(
+        Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "mesh_intervals"),
+        out.num_intervals);
+    auto out_ptr = out.row_ptr;
+    auto out_intervals = out.intervals;
+    Kokkos::parallel_for(
+        "complement_fill",
+        Kokkos::RangePolicy<ExecSpace>(exec, 0, m),
+        KOKKOS_LAMBDA(const std::size_t j) {
+          const std::size_t i = mesh_row(kept(j));
+          if (i == num_rows) {
+            out_intervals(out_ptr(j)) = Interval{x_lo, x_hi};
+            return;
+          }
+          detail::row_gaps<false>(intervals, row_ptr(i), row_ptr(i + 1), x_lo, x_hi,
+                                  out_intervals, out_ptr(j));
+        });
+  }
+
+  return out;
+}
+
+template <class MemorySpace>
+Mesh3D<MemorySpace> complement(const Mesh3D<MemorySpace>& mesh, const CellBox& box) {
+  return complement(typename MemorySpace::execution_space(), mesh, box);
+}
+
+} // namespace subsetix
@@ -0,0 +1,248 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/profiling.hpp>
+#include <subsetix/detail/utils.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace subsetix {
+
+/**
+ * @brief Connected components of a mesh, one label per interval.
+ *
+ * Every cell of interval k belongs to component labels(k); labels are
+ * numbered 0 .. num_components - 1 in order of the first interval of each
+ * component.
+ */
+template <class MemorySpace>
+struct ComponentLabels {
+  using LabelView = Kokkos::View<std::size_t*, MemorySpace>;
+
+  LabelView labels;  // [num_intervals]
+  std::size_t num_components = 0;
+};
+
+namespace detail {
+
+// ============================================================================
+// Lock-free union-find over interval indices
+// ============================================================================
+//
+// Roots are only ever hooked below a smaller index, so parent(x) <= x and an
+// ancestor of x stays an ancestor: the path halving writes of concurrent
+// finds are benign.
+
+template <class ParentView>
+KOKKOS_INLINE_FUNCTION
+std::size_t uf_find(const ParentView& parent, std::size_t x) {
+  while (true) {
+    const std::size_t p = Kokkos::atomic_load(&parent(x));
+    if (p == x) {
+      return x;
+    }
+    const std::size_t gp = Kokkos::atomic_load(&parent(p));
+    if (gp != p) {
+      Kokkos::atomic_store(&parent(x), gp);
+    }
+    x = gp;
+  }
+}
+
+template <class ParentView>
+KOKKOS_INLINE_FUNCTION
+void uf_union(const ParentView& parent, std::size_t a, std::size_t b) {
+  while (true) {
+    a = uf_find(parent, a);
+    b = uf_find(parent, b);
+    if (a == b) {
+      return;
+    }
+    if (a < b) {
+      const std::size_t t = a;
+      a = b;
+      b = t;
+    }
+    // Hook the larger root a below b, unless a was hooked meanwhile
+    if (Kokkos::atomic_compare_exchange(&parent(a), a, b) == a) {
+      return;
+    }
+  }
+}
+
+/**
+ * @brief Union every interval of row ra with the intervals of row rb it
+ *        touches, where touching means a.begin < b.end + slack and
+ *        b.begin < a.end + slack (slack 0: shared faces, 1: also diagonal in x).
+ */
+template <class MeshType, class ParentView>
+KOKKOS_INLINE_FUNCTION
+void uf_union_rows(const MeshType& mesh, const ParentView& parent,
+                   std::size_t ra, std::size_t rb, std::int64_t slack) {
+  std::size_t jb = mesh.row_ptr(rb);
+  const std::size_t end_b = mesh.row_ptr(rb + 1);
+  for (std::size_t ia = mesh.row_ptr(ra); ia < mesh.row_ptr(ra + 1); ++ia) {
+    const Interval a = mesh.intervals(ia);
+    // Intervals of rb ending before a are done for every later interval of ra
+    // (bounds widened to 64 bits: end + slack may exceed INT32_MAX)
+    while (jb < end_b && mesh.intervals(jb).end + slack <= a.begin) {
+      ++jb;
+    }
+    for (std::size_t k = jb; k < end_b && mesh.intervals(k).begin < a.end + slack; ++k) {
+      uf_union(parent, ia, k);
+    }
+  }
+}
+
+} // namespace detail
+
+/**
+ * @brief Label the connected components of a mesh.
+ *
+ * Components are computed on intervals rather than cells, by a parallel
+ * union-find whose edges are:
+ * - consecutive intervals of a row that touch (end == next begin);
+ * - intervals of neighbouring rows whose cells are neighbours under
+ *   connectivity: rows (y+1, z) and (y, z+1) with overlapping x ranges for
+ *   Face; diagonal rows (y+1, z±1) too for Edge, and x ranges one cell apart
+ *   count as well in face rows for Edge and in all rows for Vertex.
+ * Every row only looks at its neighbours in +y / +z, so each pair of rows is
+ * visited once.
+ *
+ * @param exec Execution space instance the kernels are enqueued on
+ * @param mesh Input mesh
+ * @param connectivity Neighbourhood of a cell (default: faces)
+ * @return Component label of every interval and the number of components
+ */
+template <class ExecSpace, class MemorySpace>
+ComponentLabels<MemorySpace> label_components(const ExecSpace& exec,
+                                              const Mesh3D<MemorySpace>& mesh,
+                                              Connectivity connectivity = Connectivity::Face) {
+  using LabelView = typename ComponentLabels<MemorySpace>::LabelView;
+  static_assert(Kokkos::SpaceAccessibility<ExecSpace, MemorySpace>::accessible,
+                "label_components: execution space cannot access the mesh memory space");
+
+  const profiling::ScopedRegion<ExecSpace> op_region(exec, "label_components");
+
+  ComponentLabels<MemorySpace> out;
+  const std::size_t n = mesh.num_intervals;
+  if (n == 0) {
+    return out;
+  }
+
+  const std::int64_t face_slack = (connectivity == Connectivity::Face) ? 0 : 1;
+  const std::int64_t diagonal_slack = (connectivity == Connectivity::Vertex) ? 1 : 0;
+  const bool diagonal_rows = (connectivity != Connectivity::Face);
+
+  // Phase 1: Union along x within rows and with the +y / +z neighbour rows
+  LabelView parent(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "components_parent"), n);
+  Kokkos::parallel_for(
+      "components_init",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, n),
+      KOKKOS_LAMBDA(const std::size_t k) { parent(k) = k; });
+
+  Kokkos::parallel_for(
+      "components_union",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, mesh.num_rows),
+      KOKKOS_LAMBDA(const std::size_t r) {
+        const std::size_t begin = mesh.row_ptr(r);
+        const std::size_t end = mesh.row_ptr(r + 1);
+        for (std::size_t k = begin; k + 1 < end; ++k) {
+          if (mesh.intervals(k).end == mesh.intervals(k + 1).begin) {
+            detail::uf_union(parent, k, k + 1);
+          }
+        }
+
+        const RowKey key = mesh.row_keys(r);
+        const int dys[4] = {1, 0, 1, 1};
+        const int dzs[4] = {0, 1, 1, -1};
+        const int num_neighbours = diagonal_rows ? 4 : 2;
+        for (int d = 0; d < num_neighbours; ++d) {
+          const std::int64_t y = static_cast<std::int64_t>(key.y) + dys[d];
+          const std::int64_t z = static_cast<std::int64_t>(key.z) + dzs[d];
+          if (y > std::numeric_limits<Coord>::max() || z > std::numeric_limits<Coord>::max() ||
+              z < std::numeric_limits<Coord>::min()) {
+            continue;
+          }
+          const int rb = subsetix::detail::find_row_by_yz(mesh.row_keys, mesh.num_rows,
+                                                          static_cast<Coord>(y),
+                                                          static_cast<Coord>(z));
+          if (rb >= 0) {
+            detail::uf_union_rows(mesh, parent, r, static_cast<std::size_t>(rb),
+                                  (d < 2) ? face_slack : diagonal_slack);
+          }
+        }
+      });
+
+  // Phase 2: Flatten and number the roots in index order
+  LabelView is_root(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "components_is_root"),
+                    n);
+  Kokkos::parallel_for(
+      "components_flatten",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, n),
+      KOKKOS_LAMBDA(const std::size_t k) {
+        const std::size_t root = detail::uf_find(parent, k);
+        Kokkos::atomic_store(&parent(k), root);
+        is_root(k) = (root == k) ? 1 : 0;
+      });
+
+  LabelView root_ids(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "components_root_ids"),
+                     n + 1);
+  out.num_components = subsetix::detail::exclusive_scan_csr_row_ptr<std::size_t>(
+      exec, "components_scan", n, is_root, root_ids);
+
+  // Phase 3: Label every interval with the number of its root
+  out.labels = LabelView(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "components_labels"),
+                         n);
+  auto labels = out.labels;
+  Kokkos::parallel_for(
+      "components_label",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, n),
+      KOKKOS_LAMBDA(const std::size_t k) { labels(k) = root_ids(parent(k)); });
+
+  return out;
+}
+
+template <class MemorySpace>
+ComponentLabels<MemorySpace> label_components(const Mesh3D<MemorySpace>& mesh,
+                                              Connectivity connectivity = Connectivity::Face) {
+  return label_components(typename MemorySpace::execution_space(), mesh, connectivity);
+}
+
+/**
+ * @brief Number of cells of every component (e.g. droplet volumes).
+ *
+ * @return View of components.num_components cell counts
+ */
+template <class ExecSpace, class MemorySpace>
+Kokkos::View<std::size_t*, MemorySpace> component_cells(
+    const ExecSpace& exec, const Mesh3D<MemorySpace>& mesh,
+    const ComponentLabels<MemorySpace>& components) {
+  Kokkos::View<std::size_t*, MemorySpace> cells(Kokkos::view_alloc(exec, "component_cells"),
+                                                components.num_components);
+  auto labels = components.labels;
+  auto intervals = mesh.intervals;
+  Kokkos::parallel_for(
+      "component_cells",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, mesh.num_intervals),
+      KOKKOS_LAMBDA(const std::size_t k) {
+        const Interval iv = intervals(k);
+        Kokkos::atomic_add(&cells(labels(k)),
+                           static_cast<std::size_t>(static_cast<std::int64_t>(iv.end) - iv.begin));
+      });
+  return cells;
+}
+
+template <class MemorySpace>
+Kokkos::View<std::size_t*, MemorySpace> component_cells(
+    const Mesh3D<MemorySpace>& mesh, const ComponentLabels<MemorySpace>& components) {
+  return component_cells(typename MemorySpace::execution_space(), mesh, components);
+}
+
+} // namespace subsetix
@@ -0,0 +1,311 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/detail/utils.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <cstddef>
+
+namespace subsetix {
+namespace detail {
+
+// ============================================================================
+// Box neighbourhood queries
+// ============================================================================
+
+/**
+ * @brief Covered X segments of the box neighbourhood of a mesh, queried per row.
+ *
+ * A point (x, y, z) is covered if some cell of the mesh lies within
+ * Chebyshev distance width of it, i.e. in the (2 width + 1)^3 box around it.
+ */
+template <class MemorySpace>
+struct BoxNeighbourhood {
+  Mesh3D<MemorySpace> mesh;
+  Coord width = 0;
+
+  // First interval of row r whose dilated end lies beyond x, or the row end
+  KOKKOS_INLINE_FUNCTION
+  std::size_t first_ending_after(std::size_t r, Coord x) const {
+    std::size_t lo = mesh.row_ptr(r);
+    std::size_t hi = mesh.row_ptr(r + 1);
+    while (lo < hi) {
+      const std::size_t mid = lo + (hi - lo) / 2;
+      if (mesh.intervals(mid).end + width <= x) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    return lo;
+  }
+
+  /**
+   * @brief First covered segment [begin, end) of row (y, z) with end > x.
+   *
+   * @return false if nothing at or after x is covered
+   */
+  KOKKOS_INLINE_FUNCTION
+  bool next_segment(Coord y, Coord z, Coord x, Coord& begin, Coord& end) const {
+    bool found = false;
+    for (Coord dy = -width; dy <= width; ++dy) {
+      for (Coord dz = -width; dz <= width; ++dz) {
+        const int r = find_row_by_yz(mesh.row_keys, mesh.num_rows, y + dy, z + dz);
+        if (r < 0) {
+          continue;
+        }
+        const std::size_t row = static_cast<std::size_t>(r);
+        const std::size_t k = first_ending_after(row, x);
+        if (k < mesh.row_ptr(row + 1)) {
+          const Coord b = mesh.intervals(k).begin - width;
+          const Coord s = (b > x) ? b : x;
+          if (!found || s < begin) {
+            begin = s;
+            found = true;
+          }
+        }
+      }
+    }
+    if (!found) {
+      return false;
+    }
+
+    // Extend through every dilated interval that covers the current end
+    end = begin;
+    bool extended = true;
+    while (extended) {
+      extended = false;
+      for (Coord dy = -width; dy <= width; ++dy) {
+        for (Coord dz = -width; dz <= width; ++dz) {
+          const int r = find_row_by_yz(mesh.row_keys, mesh.num_rows, y + dy, z + dz);
+          if (r < 0) {
+            continue;
+          }
+          const std::size_t row = static_cast<std::size_t>(r);
+          const std::size_t k = first_ending_after(row, end);
+          if (k < mesh.row_ptr(row + 1) && mesh.intervals(k).begin - width <= end) {
+            end = mesh.intervals(k).end + width;
+            extended = true;
+          }
+        }
+      }
+    }
+    return true;
+  }
+};
+
+/**
+ * @brief Keep the cells of a mesh that lie within a box neighbourhood of another.
+ *
+ * Returns the cells of candidate within Chebyshev distance width of some
+ * cell of near. Intervals of candidate are split but never merged, so every
+ * output interval lies inside one candidate interval. Rows left empty are
+ * dropped.
+ *
+ * Algorithm:
+ * 1. Count - walk each candidate interval through the covered segments
+ * 2. Compact - keep rows with at least one clipped interval
+ * 3. Scan - compute CSR offsets
+ * 4. Fill - write clipped intervals
+ *
+ * All work is enqueued on exec.
+ */
+template <class ExecSpace, class MemorySpace>
+Mesh3D<MemorySpace> clip_to_neighbourhood(const ExecSpace& exec,
+                                          const Mesh3D<MemorySpace>& candidate,
+                                          const Mesh3D<MemorySpace>& near,
+                                          Coord width) {
+  using MeshType = Mesh3D<MemorySpace>;
+  using IndexView = Kokkos::View<std::size_t*, MemorySpace>;
+
+  const std::size_t n = candidate.num_rows;
+  if (n == 0 || near.num_rows == 0) {
+    return MeshType{};
+  }
+
+  const BoxNeighbourhood<MemorySpace> hood{near, width};
+  auto rows = candidate.row_keys;
+  auto row_ptr = candidate.row_ptr;
+  auto intervals = candidate.intervals;
+
+  // Phase 1: Count clipped intervals per candidate row
+  IndexView counts(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "clip_counts"), n);
+  Kokkos::parallel_for(
+      "clip_count",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, n),
+      KOKKOS_LAMBDA(const std::size_t i) {
+        const RowKey key = rows(i);
+        std::size_t count = 0;
+        for (std::size_t k = row_ptr(i); k < row_ptr(i + 1); ++k) {
+          const Interval iv = intervals(k);
+          Coord x = iv.begin;
+          Coord begin = 0;
+          Coord end = 0;
+          while (x < iv.end && hood.next_segment(key.y, key.z, x, begin, end) &&
+                 begin < iv.end) {
+            ++count;
+            x = end;
+          }
+        }
+        counts(i) = count;
+      });
+
+  // Phase 2: Compact rows with at least one interval
+  IndexView kept(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "clip_kept_rows"), n);
+  Kokkos::View<std::size_t, MemorySpace> num_kept_view(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "clip_num_kept"));
+  Kokkos::parallel_scan(
+      "clip_row_scan",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, n),
+      KOKKOS_LAMBDA(const std::size_t i, std::size_t& update, const bool final_pass) {
+        const std::size_t flag = (counts(i) > 0) ? 1 : 0;
+        if (final_pass) {
+          if (flag) {
+            kept(update) = i;
+          }
+          if (i + 1 == n) {
+            num_kept_view() = update + flag;
+          }
+        }
+        update += flag;
+      });
+
+  std::size_t m = 0;
+  Kokkos::deep_copy(exec, m, num_kept_view);
+  exec.fence("clip_row_scan");
+  if (m == 0) {
+    return MeshType{};
+  }
+
+  MeshType out;
+  out.num_rows = m;
+  out.row_keys = typename MeshType::RowKeyView(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "mesh_row_keys"), m);
+  out.row_ptr = typename MeshType::IndexView(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "mesh_row_ptr"), m + 1);
+
+  IndexView kept_counts(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "clip_kept_counts"), m);
+  auto out_keys = out.row_keys;
+  Kokkos::parallel_for(
+      "clip_row_compact",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, m),
+      KOKKOS_LAMBDA(const std::size_t j) {
+        out_keys(j) = rows(kept(j));
+        kept_counts(j) = counts(kept(j));
+      });
+
+  // Phase 3: CSR offsets
+  out.num_intervals = exclusive_scan_csr_row_ptr<std::size_t>(
+      exec, "clip_scan", m, kept_counts, out.row_ptr);
+  out.intervals = typename MeshType::IntervalView(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "mesh_intervals"), out.num_intervals);
+
+  // Phase 4: Fill clipped intervals
+  auto out_ptr = out.row_ptr;
+  auto out_intervals = out.intervals;
+  Kokkos::parallel_for(
+      "clip_fill",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, m),
+      KOKKOS_LAMBDA(const std::size_t j) {
+        const std::size_t i = kept(j);
+        const RowKey key = rows(i);
+        std::size_t pos = out_ptr(j);
+        for (std::size_t k = row_ptr(i); k < row_ptr(i + 1); ++k) {
+          const Interval iv = intervals(k);
+          Coord x = iv.begin;
+          Coord begin = 0;
+          Coord end = 0;
+          while (x < iv.end && hood.next_segment(key.y, key.z, x, begin, end) &&
+                 begin < iv.end) {
+            out_intervals(pos++) = Interval{begin, (end < iv.end) ? end : iv.end};
+            x = end;
+          }
+        }
+      });
+
+  return out;
+}
+
+template <class MemorySpace>
+Mesh3D<MemorySpace> clip_to_neighbourhood(const Mesh3D<MemorySpace>& candidate,
+                                          const Mesh3D<MemorySpace>& near,
+                                          Coord width) {
+  return clip_to_neighbourhood(typename MemorySpace::execution_space(), candidate, near,
+                               width);
+}
+
+/**
+ * @brief Map every cell of a sub-mesh to its index in the field layout of a super-mesh.
+ *
+ * Every interval of sub must lie inside a single interval of super.
+ *
+ * @param exec Execution space instance the kernel is enqueued on
+ * @param sub Mesh whose cells are all cells of super
+ * @param super Canonical mesh containing sub
+ * @param super_offsets Cell offsets of the intervals of super
+ * @param sub_offsets Cell offsets of the intervals of sub
+ * @param out [sub cells] - receives the super field index of each sub cell
+ */
+template <class ExecSpace, class MemorySpace>
+void locate_cells(const ExecSpace& exec,
+                  const Mesh3D<MemorySpace>& sub,
+                  const Mesh3D<MemorySpace>& super,
+                  const Kokkos::View<std::size_t*, MemorySpace>& super_offsets,
+                  const Kokkos::View<std::size_t*, MemorySpace>& sub_offsets,
+                  const Kokkos::View<std::size_t*, MemorySpace>& out) {
+  const std::size_t num_rows_sub = sub.num_rows;
+  auto sub_rows = sub.row_keys;
+  auto sub_ptr = sub.row_ptr;
+  auto sub_intervals = sub.intervals;
+  auto super_rows = super.row_keys;
+  auto super_ptr = super.row_ptr;
+  auto super_intervals = super.intervals;
+  const std::size_t num_rows_super = super.num_rows;
+
+  Kokkos::parallel_for(
+      "locate_cells",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, sub.num_intervals),
+      KOKKOS_LAMBDA(const std::size_t k) {
+        const std::size_t i = find_segment(sub_ptr, num_rows_sub, k);
+        const RowKey key = sub_rows(i);
+        const Interval iv = sub_intervals(k);
+        // The row exists: sub is a subset of super
+        const std::size_t r = lower_bound_row(super_rows, num_rows_super, key);
+
+        // Last interval of the super row starting at or before iv.begin
+        std::size_t lo = super_ptr(r);
+        std::size_t hi = super_ptr(r + 1);
+        while (hi - lo > 1) {
+          const std::size_t mid = lo + (hi - lo) / 2;
+          if (super_intervals(mid).begin <= iv.begin) {
+            lo = mid;
+          } else {
+            hi = mid;
+          }
+        }
+
+        const std::size_t base =
+            super_offsets(lo) + static_cast<std::size_t>(iv.begin - super_intervals(lo).begin);
+        const std::size_t dst = sub_offsets(k);
+        for (Coord c = 0; c < iv.size(); ++c) {
+          out(dst + static_cast<std::size_t>(c)) = base + static_cast<std::size_t>(c);
+        }
+      });
+}
+
+template <class MemorySpace>
+void locate_cells(const Mesh3D<MemorySpace>& sub,
+                  const Mesh3D<MemorySpace>& super,
+                  const Kokkos::View<std::size_t*, MemorySpace>& super_offsets,
+                  const Kokkos::View<std::size_t*, MemorySpace>& sub_offsets,
+                  const Kokkos::View<std::size_t*, MemorySpace>& out) {
+  locate_cells(typename MemorySpace::execution_space(), sub, super, super_offsets, sub_offsets,
+               out);
+}
+
+} // namespace detail
+} // namespace subsetix
@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <subsetix/mesh.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <cstdint>
+
+namespace subsetix {
+
+/**
+ * @brief Space-filling curve used to order (y, z) rows.
+ */
+enum class CurveType {
+  Morton,  // Z-order: bit interleaving, cheap to compute
+  Hilbert  // Hilbert order: consecutive keys are always face neighbours
+};
+
+namespace detail {
+
+// ============================================================================
+// Space-filling curve keys on a 2^32 x 2^32 grid
+// ============================================================================
+
+/**
+ * @brief Spread the 32 bits of v to the even bit positions of a 64-bit word.
+ */
+KOKKOS_INLINE_FUNCTION
+std::uint64_t spread_bits_2d(std::uint32_t v) {
+  std::uint64_t x = v;
+  x = (x | (x << 16)) & 0x0000FFFF0000FFFFULL;
+  x = (x | (x << 8)) & 0x00FF00FF00FF00FFULL;
+  x = (x | (x << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+  x = (x | (x << 2)) & 0x3333333333333333ULL;
+  x = (x | (x << 1)) & 0x5555555555555555ULL;
+  return x;
+}
+
+/**
+ * @brief Morton (Z-order) key of (a, b); a occupies the odd bits.
+ */
+KOKKOS_INLINE_FUNCTION
+std::uint64_t morton_key_2d(std::uint32_t a, std::uint32_t b) {
+  return (spread_bits_2d(a) << 1) | spread_bits_2d(b);
+}
+
+/**
+ * @brief Hilbert curve index of (a, b) on the full 2^32 x 2^32 grid.
+ *
+ * Iterative quadrant descent; rotations use the full-grid reflection
+ * (n - 1 - v == ~v for n = 2^32), so no grid size parameter is needed.
+ */
+KOKKOS_INLINE_FUNCTION
+std::uint64_t hilbert_key_2d(std::uint32_t a, std::uint32_t b) {
+  std::uint64_t d = 0;
+  for (std::uint32_t s = 0x80000000U; s > 0; s >>= 1) {
+    const std::uint32_t ra = (a & s) ? 1U : 0U;
+    const std::uint32_t rb = (b & s) ? 1U : 0U;
+    d += static_cast<std::uint64_t>(s) * s * ((3U * ra) ^ rb);
+    if (rb == 0) {
+      if (ra == 1) {
+        a = ~a;
+        b = ~b;
+      }
+      const std::uint32_t t = a;
+      a = b;
+      b = t;
+    }
+  }
+  return d;
+}
+
+/**
+ * @brief Curve key of a row, with coordinates shifted to be non-negative.
+ *
+ * Shifting by the mesh minimum keeps rows on both sides of zero inside the
+ * same curve quadrant. Origin-anchored keys (origin_row_curve_key) flip the
+ * sign bit instead, which puts a top-level quadrant boundary at zero.
+ */
+KOKKOS_INLINE_FUNCTION
+std::uint64_t row_curve_key(CurveType curve, Coord y, Coord z, Coord y_min, Coord z_min) {
+  const auto a = static_cast<std::uint32_t>(static_cast<std::int64_t>(y) - y_min);
+  const auto b = static_cast<std::uint32_t>(static_cast<std::int64_t>(z) - z_min);
+  return (curve == CurveType::Hilbert) ? hilbert_key_2d(a, b) : morton_key_2d(a, b);
+}
+
+/**
+ * @brief Curve key of the 2^block_bits square tile holding grid point (a, b),
+ *        refined lexicographically inside the tile.
+ *
+ * Tiles within the square of side 2^k at grid point (0, 0) have curve keys
+ * below 4^k for both curves, so tile key and in-tile offset share one 64-bit
+ * word. block_bits == 0 gives the plain curve key; block_bits must be in
+ * [0, 31] (checked by reorder_rows).
+ */
+KOKKOS_INLINE_FUNCTION
+std::uint64_t blocked_curve_key(CurveType curve, std::uint32_t a, std::uint32_t b,
+                                int block_bits) {
+  const std::uint32_t mask = (std::uint32_t(1) << block_bits) - 1U;
+  const std::uint32_t ta = a >> block_bits;
+  const std::uint32_t tb = b >> block_bits;
+  const std::uint64_t tile =
+      (curve == CurveType::Hilbert) ? hilbert_key_2d(ta, tb) : morton_key_2d(ta, tb);
+  const std::uint64_t local =
+      (static_cast<std::uint64_t>(a & mask) << block_bits) | (b & mask);
+  return (tile << (2 * block_bits)) | local;
+}
+
+/**
+ * @brief Blocked curve key of a row, with coordinates shifted by (y_min, z_min).
+ */
+KOKKOS_INLINE_FUNCTION
+std::uint64_t blocked_row_curve_key(CurveType curve, Coord y, Coord z,
+                                    Coord y_min, Coord z_min, int block_bits) {
+  const auto a = static_cast<std::uint32_t>(static_cast<std::int64_t>(y) - y_min);
+  const auto b = static_cast<std::uint32_t>(static_cast<std::int64_t>(z) - z_min);
+  return blocked_curve_key(curve, a, b, block_bits);
+}
+
+/**
+ * @brief Blocked curve key of a row that depends on (y, z) alone.
+ *
+ * Flipping the sign bit maps coordinates to the grid in order, so tiles are
+ * aligned on multiples of 2^block_bits from zero. Zero is also where the
+ * top-level quadrants meet: rows on opposite sides of y = 0 or z = 0 get
+ * distant keys even when they are neighbours.
+ */
+KOKKOS_INLINE_FUNCTION
+std::uint64_t origin_row_curve_key(CurveType curve, Coord y, Coord z, int block_bits) {
+  const auto a = static_cast<std::uint32_t>(y) ^ 0x80000000U;
+  const auto b = static_cast<std::uint32_t>(z) ^ 0x80000000U;
+  return blocked_curve_key(curve, a, b, block_bits);
+}
+
+/**
+ * @brief Monotone 64-bit packing of (y, z) in canonical lexicographic order.
+ */
+KOKKOS_INLINE_FUNCTION
+std::uint64_t canonical_row_key(Coord y, Coord z) {
+  const auto uy = static_cast<std::uint32_t>(y) ^ 0x80000000U;
+  const auto uz = static_cast<std::uint32_t>(z) ^ 0x80000000U;
+  return (static_cast<std::uint64_t>(uy) << 32) | uz;
+}
+
+} // namespace detail
+} // namespace subsetix
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <subsetix/mesh.hpp>
+
 #include <Kokkos_Core.hpp>
 #include <Kokkos_StdAlgorithms.hpp>
 #include <string>
@@ -40,15 +42,19 @@ inline void ensure_view_capacity(ViewType& view,
  * For each i in [0, n), writes row_ptr(i) = sum of counts(0..i-1).
  * Also writes row_ptr(n) = total.
  * Returns the total sum of all counts.
+ *
+ * All work is enqueued on exec; returning the total waits for exec only.
  */
-template <typename T, class CountView, class IndexView>
+template <typename T, class ExecSpace, class CountView, class IndexView>
 T exclusive_scan_csr_row_ptr(
+    const ExecSpace& exec,
     const std::string& label,
     std::size_t n,
     const CountView& counts,
     IndexView& row_ptr) {
   if (n == 0) {
-    Kokkos::deep_copy(Kokkos::subview(row_ptr, 0), T(0));
+    Kokkos::deep_copy(exec, Kokkos::subview(row_ptr, 0), T(0));
+    exec.fence(label);
     return T(0);
   }
 
@@ -57,23 +63,35 @@ T exclusive_scan_csr_row_ptr(
   auto row_ptr_sub = Kokkos::subview(row_ptr, std::make_pair(std::size_t(0), n));
 
   // Exclusive scan into row_ptr[0..n)
-  Kokkos::Experimental::exclusive_scan(
-      Kokkos::DefaultExecutionSpace(), counts_sub, row_ptr_sub, T(0));
+  Kokkos::Experimental::exclusive_scan(exec, counts_sub, row_ptr_sub, T(0));
 
   // Compute total and set row_ptr[n]
   T total = T(0);
   Kokkos::parallel_reduce(
       label + "_total",
-      Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, n),
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, n),
       KOKKOS_LAMBDA(const std::size_t i, T& sum) {
         sum += static_cast<T>(counts(i));
       },
       total);
 
-  Kokkos::deep_copy(Kokkos::subview(row_ptr, n), total);
+  Kokkos::deep_copy(exec, Kokkos::subview(row_ptr, n), total);
+  exec.fence(label);
   return total;
 }
 
+/**
+ * @brief Exclusive CSR scan on the default execution space instance.
+ */
+template <typename T, class CountView, class IndexView>
+T exclusive_scan_csr_row_ptr(
+    const std::string& label,
+    std::size_t n,
+    const CountView& counts,
+    IndexView& row_ptr) {
+  return exclusive_scan_csr_row_ptr<T>(Kokkos::DefaultExecutionSpace(), label, n, counts, row_ptr);
+}
+
 // ============================================================================
 // Binary search utilities
 // ============================================================================
@@ -114,6 +132,79 @@ int find_row_by_yz(const RowKeyView& rows, std::size_t num_rows, Coord y, Coord
   return -1;
 }
 
+/**
+ * @brief First row whose key is not less than key (rows sorted by y, then z).
+ *
+ * @return Index in [0, num_rows]; num_rows if every key is smaller
+ */
+template <class RowKeyView>
+KOKKOS_INLINE_FUNCTION
+std::size_t lower_bound_row(const RowKeyView& rows, std::size_t num_rows, const RowKey& key) {
+  std::size_t lo = 0;
+  std::size_t hi = num_rows;
+
+  while (lo < hi) {
+    const std::size_t mid = lo + (hi - lo) / 2;
+    if (rows(mid) < key) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+
+  return lo;
+}
+
+/**
+ * @brief First row whose key is greater than key (rows sorted by y, then z).
+ *
+ * @return Index in [0, num_rows]; num_rows if no key is greater
+ */
+template <class RowKeyView>
+KOKKOS_INLINE_FUNCTION
+std::size_t upper_bound_row(const RowKeyView& rows, std::size_t num_rows, const RowKey& key) {
+  std::size_t lo = 0;
+  std::size_t hi = num_rows;
+
+  while (lo < hi) {
+    const std::size_t mid = lo + (hi - lo) / 2;
+    if (key < rows(mid)) {
+      hi = mid;
+    } else {
+      lo = mid + 1;
+    }
+  }
+
+  return lo;
+}
+
+/**
+ * @brief Find the CSR segment that owns a flat position.
+ *
+ * @param offsets CSR offsets with n + 1 entries (offsets(0) == 0)
+ * @param n Number of segments
+ * @param pos Flat position, must satisfy pos < offsets(n)
+ * @return The largest i in [0, n) with offsets(i) <= pos (empty segments
+ *         share their offset with a successor and are therefore skipped)
+ */
+template <class OffsetView>
+KOKKOS_INLINE_FUNCTION
+std::size_t find_segment(const OffsetView& offsets, std::size_t n, std::size_t pos) {
+  std::size_t lo = 0;
+  std::size_t hi = n;
+
+  while (hi - lo > 1) {
+    const std::size_t mid = lo + (hi - lo) / 2;
+    if (static_cast<std::size_t>(offsets(mid)) <= pos) {
+      lo = mid;
+    } else {
+      hi = mid;
+    }
+  }
+
+  return lo;
+}
+
 /**
  * @brief Extract interval ranges for two rows given their indices.
  *
@@ -0,0 +1,220 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/field.hpp>
+#include <subsetix/profiling.hpp>
+#include <subsetix/detail/utils.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+namespace subsetix {
+namespace detail {
+
+// ============================================================================
+// Cell lookups of the separable distance transform
+// ============================================================================
+
+template <class MemorySpace>
+struct DistanceLookup {
+  Mesh3D<MemorySpace> mesh;
+  Kokkos::View<std::size_t*, MemorySpace> offsets;  // cell offsets per interval
+
+  /**
+   * @brief Interval of row (y, z) holding x.
+   *
+   * @return false if the cell (x, y, z) is not in the mesh, also when y or z
+   *         lie outside the Coord range
+   */
+  KOKKOS_INLINE_FUNCTION
+  bool locate(std::int64_t y, std::int64_t z, std::int64_t x, std::size_t& r,
+              std::size_t& k) const {
+    if (y < std::numeric_limits<Coord>::min() || y > std::numeric_limits<Coord>::max() ||
+        z < std::numeric_limits<Coord>::min() || z > std::numeric_limits<Coord>::max()) {
+      return false;
+    }
+    const int row = find_row_by_yz(mesh.row_keys, mesh.num_rows, static_cast<Coord>(y),
+                                   static_cast<Coord>(z));
+    if (row < 0) {
+      return false;
+    }
+    r = static_cast<std::size_t>(row);
+    // First interval of the row ending after x
+    std::size_t lo = mesh.row_ptr(r);
+    std::size_t hi = mesh.row_ptr(r + 1);
+    while (lo < hi) {
+      const std::size_t mid = lo + (hi - lo) / 2;
+      if (mesh.intervals(mid).end <= x) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    k = lo;
+    return lo < mesh.row_ptr(r + 1) && mesh.intervals(lo).begin <= x;
+  }
+
+  /**
+   * @brief Squared distance along x from cell x of interval k (row r) to the
+   *        nearest cell outside its run of touching intervals.
+   */
+  KOKKOS_INLINE_FUNCTION
+  double x_distance_sq(std::size_t r, std::size_t k, std::int64_t x) const {
+    std::size_t first = k;
+    while (first > mesh.row_ptr(r) &&
+           mesh.intervals(first - 1).end == mesh.intervals(first).begin) {
+      --first;
+    }
+    std::size_t last = k;
+    while (last + 1 < mesh.row_ptr(r + 1) &&
+           mesh.intervals(last).end == mesh.intervals(last + 1).begin) {
+      ++last;
+    }
+    const std::int64_t left = x - mesh.intervals(first).begin + 1;
+    const std::int64_t right = static_cast<std::int64_t>(mesh.intervals(last).end) - x;
+    const double d = static_cast<double>((left < right) ? left : right);
+    return d * d;
+  }
+
+  // Flat position of cell x of interval k
+  KOKKOS_INLINE_FUNCTION
+  std::size_t cell(std::size_t k, std::int64_t x) const {
+    return offsets(k) + static_cast<std::size_t>(x - mesh.intervals(k).begin);
+  }
+};
+
+} // namespace detail
+
+// ============================================================================
+// Distance transform
+// ============================================================================
+
+/**
+ * @brief Euclidean distance of every cell of a mesh to the nearest cell
+ *        outside it.
+ *
+ * Distances are measured between cell centres, in cells: cells with a face
+ * neighbour outside the mesh get 1, the centre of a 5^3 block gets 3. The
+ * transform is exact and separable (squared distances are minimised along
+ * one axis at a time) and never leaves the mesh layout:
+ * 1. X - per interval, from the endpoints of its run of touching intervals
+ * 2. Y - g2(x, y, z) = min over s of g1(x, y + s, z) + s^2, where g1 is read
+ *        from the intervals of row (y + s, z) and is 0 outside the mesh
+ * 3. Z - the same along z, reading g2 from the pass 2 buffer
+ * A pass stops its search at the first s with s^2 above the best value
+ * found, so a cell costs O(d log R) lookups for distance d; max_distance
+ * caps both the result and this cost (narrow bands near the boundary).
+ *
+ * @param exec Execution space instance the kernels are enqueued on
+ * @param mesh Input mesh
+ * @param max_distance Distances are clamped to this value (default: none)
+ * @return Field of distances laid out on mesh
+ */
+template <class ExecSpace, class MemorySpace>
+Field3D<float, MemorySpace> distance_transform(
+    const ExecSpace& exec,
+    const Mesh3D<MemorySpace>& mesh,
+    double max_distance = std::numeric_limits<double>::infinity()) {
+  using FieldType = Field3D<float, MemorySpace>;
+  using Region = profiling::ScopedRegion<ExecSpace>;
+  static_assert(Kokkos::SpaceAccessibility<ExecSpace, MemorySpace>::accessible,
+                "distance_transform: execution space cannot access the mesh memory space");
+  if (!(max_distance >= 0.0)) {
+    throw std::invalid_argument("distance_transform: max_distance must be >= 0");
+  }
+
+  const Region op_region(exec, "distance_transform");
+
+  FieldType field;
+  field.num_cells = compute_interval_cell_offsets(exec, mesh, field.interval_offsets);
+  field.values = typename FieldType::ValueView(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "distance"), field.num_cells);
+  if (field.num_cells == 0) {
+    return field;
+  }
+
+  const detail::DistanceLookup<MemorySpace> lookup{mesh, field.interval_offsets};
+  const std::size_t num_intervals = mesh.num_intervals;
+  const std::size_t num_rows = mesh.num_rows;
+  const double cap_sq = max_distance * max_distance;
+
+  // Passes 1 + 2: x distances evaluated on the fly, minimised along y
+  Kokkos::View<double*, MemorySpace> g2;
+  {
+    const Region region(exec, "y_pass");
+    g2 = Kokkos::View<double*, MemorySpace>(
+        Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "distance_g2"), field.num_cells);
+    Kokkos::parallel_for(
+        "distance_y_pass",
+        Kokkos::RangePolicy<ExecSpace>(exec, 0, field.num_cells),
+        KOKKOS_LAMBDA(const std::size_t c) {
+          const std::size_t k = detail::find_segment(lookup.offsets, num_intervals, c);
+          const std::size_t r = detail::find_segment(lookup.mesh.row_ptr, num_rows, k);
+          const RowKey key = lookup.mesh.row_keys(r);
+          const std::int64_t x = lookup.mesh.intervals(k).begin +
+                                 static_cast<std::int64_t>(c - lookup.offsets(k));
+
+          double best = lookup.x_distance_sq(r, k, x);
+          best = (best < cap_sq) ? best : cap_sq;
+          for (std::int64_t s = 1; static_cast<double>(s * s) < best; ++s) {
+            for (int sign = -1; sign <= 1; sign += 2) {
+              std::size_t rn = 0;
+              std::size_t kn = 0;
+              const double g1 = lookup.locate(key.y + sign * s, key.z, x, rn, kn)
+                                    ? lookup.x_distance_sq(rn, kn, x)
+                                    : 0.0;
+              const double v = g1 + static_cast<double>(s * s);
+              best = (v < best) ? v : best;
+            }
+          }
+          g2(c) = best;
+        });
+  }
+
+  // Pass 3: minimise along z
+  {
+    const Region region(exec, "z_pass");
+    auto values = field.values;
+    Kokkos::parallel_for(
+        "distance_z_pass",
+        Kokkos::RangePolicy<ExecSpace>(exec, 0, field.num_cells),
+        KOKKOS_LAMBDA(const std::size_t c) {
+          const std::size_t k = detail::find_segment(lookup.offsets, num_intervals, c);
+          const std::size_t r = detail::find_segment(lookup.mesh.row_ptr, num_rows, k);
+          const RowKey key = lookup.mesh.row_keys(r);
+          const std::int64_t x = lookup.mesh.intervals(k).begin +
+                                 static_cast<std::int64_t>(c - lookup.offsets(k));
+
+          double best = g2(c);
+          for (std::int64_t s = 1; static_cast<double>(s * s) < best; ++s) {
+            for (int sign = -1; sign <= 1; sign += 2) {
+              std::size_t rn = 0;
+              std::size_t kn = 0;
+              const double prev = lookup.locate(key.y, key.z + sign * s, x, rn, kn)
+                                      ? g2(lookup.cell(kn, x))
+                                      : 0.0;
+              const double v = prev + static_cast<double>(s * s);
+              best = (v < best) ? v : best;
+            }
+          }
+          values(c) = static_cast<float>(Kokkos::sqrt(best));
+        });
+  }
+
+  return field;
+}
+
+template <class MemorySpace>
+Field3D<float, MemorySpace> distance_transform(
+    const Mesh3D<MemorySpace>& mesh,
+    double max_distance = std::numeric_limits<double>::infinity()) {
+  return distance_transform(typename MemorySpace::execution_space(), mesh, max_distance);
+}
+
+} // namespace subsetix
@@ -0,0 +1,287 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/field.hpp>
+#include <subsetix/distributed/mesh.hpp>
+#include <subsetix/detail/neighbourhood.hpp>
+#include <subsetix/intersection/v1.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <mpi.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace subsetix::distributed {
+
+/**
+ * @brief Ghost cells of a rank and the packed buffers used to refresh them.
+ *
+ * The halo holds the cells owned by other ranks within Chebyshev distance
+ * width of an owned cell (the box dilation of the owned cells, minus the
+ * owned cells, restricted to cells that exist). Values for neighbours[k]
+ * are packed from send_cells[send_ptr[k] .. send_ptr[k+1]) of the local
+ * field; values received from it are unpacked to recv_cells[recv_ptr[k] ..
+ * recv_ptr[k+1]) of the halo field.
+ */
+template <class MemorySpace>
+struct HaloPlan {
+  using IndexView = Kokkos::View<std::size_t*, MemorySpace>;
+
+  Mesh3D<MemorySpace> halo;            // Ghost cells (canonical)
+  std::vector<int> neighbours;         // Ranks exchanging values with this rank
+  std::vector<std::size_t> send_ptr;   // [num_neighbours + 1] - ranges into send_cells
+  std::vector<std::size_t> recv_ptr;   // [num_neighbours + 1] - ranges into recv_cells
+  IndexView send_cells;                // Local field index of every sent value
+  IndexView recv_cells;                // Halo field index of every received value
+  Coord width = 0;
+};
+
+namespace detail {
+
+/**
+ * @brief Ranks owning a row position in the box neighbourhood of a row.
+ *
+ * Rows near an ownership boundary (the boundary slabs) are the only rows
+ * with destinations; interior rows visit nothing.
+ */
+template <class MemorySpace>
+struct HaloDestinations {
+  typename Mesh3D<MemorySpace>::RowKeyView rows;
+  RowOwnership<MemorySpace> ownership;
+  int rank = 0;
+  Coord width = 0;
+
+  template <bool Write>
+  KOKKOS_INLINE_FUNCTION
+  std::size_t operator()(std::size_t i,
+                         const Kokkos::View<std::uint64_t*, MemorySpace>& out,
+                         std::size_t offset) const {
+    const RowKey key = rows(i);
+    std::size_t count = 0;
+    for (Coord dy = -width; dy <= width; ++dy) {
+      for (Coord dz = -width; dz <= width; ++dz) {
+        const Coord y = key.y + dy;
+        const Coord z = key.z + dz;
+        // No row exists below the global anchor
+        if (y < ownership.anchor.y || z < ownership.anchor.z) {
+          continue;
+        }
+        const int dest = ownership.owner(y, z);
+        if (dest == rank) {
+          continue;
+        }
+        if constexpr (Write) {
+          out(offset + count) = (static_cast<std::uint64_t>(dest) << 32) | i;
+        }
+        ++count;
+      }
+    }
+    return count;
+  }
+};
+
+} // namespace detail
+
+/**
+ * @brief Build the halo of width cells around the rows owned by this rank.
+ *
+ * Algorithm:
+ * 1. Boundary slabs - rows with a neighbour position owned by another rank,
+ *    grouped by that rank
+ * 2. Exchange - every rank sends its boundary slabs to the ranks they border
+ * 3. Clip - with both slabs of a rank pair known, each side computes the
+ *    same cells: received cells near own slab (halo), own cells near the
+ *    received slab (values to send)
+ * 4. Index maps - field positions of every packed and unpacked value
+ *
+ * Collective over mesh.comm. Only slab geometry is communicated. Device
+ * work is enqueued on exec.
+ *
+ * @throws std::invalid_argument if width < 0
+ */
+template <class ExecSpace, class MemorySpace>
+HaloPlan<MemorySpace> build_halo(const ExecSpace& exec,
+                                 const DistributedMesh3D<MemorySpace>& mesh,
+                                 Coord width) {
+  using intersection::v1::mesh_to;
+  using IndexView = Kokkos::View<std::size_t*, MemorySpace>;
+  using MeshType = Mesh3D<MemorySpace>;
+
+  if (width < 0) {
+    throw std::invalid_argument("subsetix::distributed::build_halo: width must be non-negative");
+  }
+
+  HaloPlan<MemorySpace> plan;
+  plan.width = width;
+  const std::size_t num_ranks = static_cast<std::size_t>(mesh.size);
+
+  // Phase 1: Boundary slabs, grouped by destination rank
+  const auto routing = detail::route_rows(
+      exec, mesh.local, num_ranks,
+      detail::HaloDestinations<MemorySpace>{mesh.local.row_keys, mesh.ownership, mesh.rank,
+                                            width});
+  const MeshType slabs = extract_rows(exec, mesh.local, routing.rows);
+  exec.fence("halo_slabs");
+
+  // Phase 2: Exchange slabs
+  std::vector<std::size_t> src_ptr;
+  const MeshType received = mesh_to<MemorySpace>(detail::exchange_rows(
+      mesh_to<Kokkos::HostSpace>(slabs), routing.dest_ptr, src_ptr, mesh.comm));
+
+  // Phase 3: Clip each pair of slabs against the other
+  std::vector<MeshType> send_parts;
+  std::vector<MeshType> recv_parts;
+  plan.send_ptr.push_back(0);
+  plan.recv_ptr.push_back(0);
+  for (std::size_t q = 0; q < num_ranks; ++q) {
+    if (routing.dest_ptr[q] == routing.dest_ptr[q + 1] || src_ptr[q] == src_ptr[q + 1]) {
+      continue;
+    }
+    const MeshType own_slab =
+        detail::slice_rows(exec, slabs, routing.dest_ptr[q], routing.dest_ptr[q + 1]);
+    const MeshType their_slab = detail::slice_rows(exec, received, src_ptr[q], src_ptr[q + 1]);
+
+    MeshType send = subsetix::detail::clip_to_neighbourhood(exec, own_slab, their_slab, width);
+    MeshType recv = subsetix::detail::clip_to_neighbourhood(exec, their_slab, own_slab, width);
+    if (send.num_rows == 0) {
+      continue;
+    }
+
+    plan.neighbours.push_back(static_cast<int>(q));
+    plan.send_ptr.push_back(plan.send_ptr.back() + count_cells(exec, send));
+    plan.recv_ptr.push_back(plan.recv_ptr.back() + count_cells(exec, recv));
+    send_parts.push_back(send);
+    recv_parts.push_back(recv);
+  }
+
+  // Phase 4: Field positions of packed and unpacked values
+  const MeshType send_all = detail::concat_meshes(exec, send_parts);
+  const MeshType recv_all = detail::concat_meshes(exec, recv_parts);
+  plan.halo = detail::sort_rows(exec, recv_all);
+
+  IndexView local_offsets;
+  IndexView halo_offsets;
+  IndexView send_offsets;
+  IndexView recv_offsets;
+  compute_interval_cell_offsets(exec, mesh.local, local_offsets);
+  compute_interval_cell_offsets(exec, plan.halo, halo_offsets);
+  compute_interval_cell_offsets(exec, send_all, send_offsets);
+  compute_interval_cell_offsets(exec, recv_all, recv_offsets);
+
+  plan.send_cells = IndexView(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "halo_send_cells"),
+      plan.send_ptr.back());
+  plan.recv_cells = IndexView(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "halo_recv_cells"),
+      plan.recv_ptr.back());
+  subsetix::detail::locate_cells(exec, send_all, mesh.local, local_offsets, send_offsets,
+                                 plan.send_cells);
+  subsetix::detail::locate_cells(exec, recv_all, plan.halo, halo_offsets, recv_offsets,
+                                 plan.recv_cells);
+  exec.fence("build_halo");
+  return plan;
+}
+
+template <class MemorySpace>
+HaloPlan<MemorySpace> build_halo(const DistributedMesh3D<MemorySpace>& mesh, Coord width) {
+  return build_halo(typename MemorySpace::execution_space(), mesh, width);
+}
+
+/**
+ * @brief Allocate a field laid out on the ghost cells of a halo plan.
+ */
+template <class T, class MemorySpace>
+Field3D<T, MemorySpace> make_halo_field(const HaloPlan<MemorySpace>& plan,
+                                        const std::string& label) {
+  return make_field<T>(plan.halo, label);
+}
+
+/**
+ * @brief Refresh ghost values from the owning ranks.
+ *
+ * Values are packed into one contiguous buffer per neighbour on the device,
+ * staged through host memory and exchanged point to point; only neighbour
+ * ranks are contacted. Collective over the ranks of mesh.comm that appear
+ * as neighbours.
+ *
+ * @param exec Execution space instance packing and unpacking run on
+ * @param field Field on mesh.local
+ * @param ghosts Field on plan.halo (see make_halo_field)
+ */
+template <class ExecSpace, class T, class MemorySpace>
+void exchange_halo(const ExecSpace& exec,
+                   const DistributedMesh3D<MemorySpace>& mesh,
+                   const HaloPlan<MemorySpace>& plan,
+                   const Field3D<T, MemorySpace>& field,
+                   Field3D<T, MemorySpace>& ghosts) {
+  constexpr int tag = 0x5e7;
+
+  const std::size_t num_send = plan.send_ptr.back();
+  const std::size_t num_recv = plan.recv_ptr.back();
+
+  // Pack
+  Kokkos::View<T*, MemorySpace> send_buf(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "halo_send_buffer"), num_send);
+  Kokkos::View<T*, MemorySpace> recv_buf(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "halo_recv_buffer"), num_recv);
+  auto send_cells = plan.send_cells;
+  auto values = field.values;
+  Kokkos::parallel_for(
+      "halo_pack",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, num_send),
+      KOKKOS_LAMBDA(const std::size_t i) { send_buf(i) = values(send_cells(i)); });
+
+  auto send_host = Kokkos::create_mirror_view(Kokkos::HostSpace{}, send_buf);
+  auto recv_host = Kokkos::create_mirror_view(Kokkos::HostSpace{}, recv_buf);
+  Kokkos::deep_copy(exec, send_host, send_buf);
+  exec.fence("halo_pack");
+
+  // Exchange with neighbours only
+  std::vector<MPI_Request> requests;
+  requests.reserve(2 * plan.neighbours.size());
+  for (std::size_t k = 0; k < plan.neighbours.size(); ++k) {
+    const std::size_t count = plan.recv_ptr[k + 1] - plan.recv_ptr[k];
+    requests.emplace_back();
+    detail::mpi_check(
+        MPI_Irecv(recv_host.data() + plan.recv_ptr[k], static_cast<int>(count * sizeof(T)),
+                  MPI_BYTE, plan.neighbours[k], tag, mesh.comm, &requests.back()),
+        "MPI_Irecv");
+  }
+  for (std::size_t k = 0; k < plan.neighbours.size(); ++k) {
+    const std::size_t count = plan.send_ptr[k + 1] - plan.send_ptr[k];
+    requests.emplace_back();
+    detail::mpi_check(
+        MPI_Isend(send_host.data() + plan.send_ptr[k], static_cast<int>(count * sizeof(T)),
+                  MPI_BYTE, plan.neighbours[k], tag, mesh.comm, &requests.back()),
+        "MPI_Isend");
+  }
+  detail::mpi_check(
+      MPI_Waitall(static_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE),
+      "MPI_Waitall");
+
+  // Unpack
+  Kokkos::deep_copy(exec, recv_buf, recv_host);
+  auto recv_cells = plan.recv_cells;
+  auto ghost_values = ghosts.values;
+  Kokkos::parallel_for(
+      "halo_unpack",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, num_recv),
+      KOKKOS_LAMBDA(const std::size_t i) { ghost_values(recv_cells(i)) = recv_buf(i); });
+  exec.fence("halo_unpack");
+}
+
+template <class T, class MemorySpace>
+void exchange_halo(const DistributedMesh3D<MemorySpace>& mesh,
+                   const HaloPlan<MemorySpace>& plan,
+                   const Field3D<T, MemorySpace>& field,
+                   Field3D<T, MemorySpace>& ghosts) {
+  exchange_halo(typename MemorySpace::execution_space(), mesh, plan, field, ghosts);
+}
+
+} // namespace subsetix::distributed
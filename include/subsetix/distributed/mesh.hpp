@@ -0,0 +1,610 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/partition.hpp>
+#include <subsetix/ordering.hpp>
+#include <subsetix/detail/utils.hpp>
+#include <subsetix/detail/sfc.hpp>
+#include <subsetix/intersection/v1.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Sort.hpp>
+#include <mpi.h>
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace subsetix::distributed {
+
+/**
+ * @brief Assignment of every (y, z) row position to a rank.
+ *
+ * Rows are ordered along a space-filling curve anchored at the global
+ * (y_min, z_min); rank p owns the curve keys in [key_begin(p), key_begin(p+1)).
+ * The map covers the whole (y, z) plane, so the owner of a position is known
+ * without communication whether or not a row exists there.
+ */
+template <class MemorySpace>
+struct RowOwnership {
+  CurveType curve = CurveType::Hilbert;
+  RowKey anchor;                                        // Global (y_min, z_min)
+  Kokkos::View<std::uint64_t*, MemorySpace> key_begin;  // [num_ranks] - first key of each rank
+  std::size_t num_ranks = 0;
+
+  KOKKOS_INLINE_FUNCTION
+  int owner(Coord y, Coord z) const {
+    const std::uint64_t key = subsetix::detail::row_curve_key(curve, y, z, anchor.y, anchor.z);
+    return static_cast<int>(subsetix::detail::find_segment(key_begin, num_ranks, key));
+  }
+};
+
+/**
+ * @brief Mesh whose rows are spread over the ranks of an MPI communicator.
+ *
+ * Invariants:
+ * - local holds exactly the rows of the global mesh owned by rank
+ * - local is a canonical Mesh3D; row sets of different ranks are disjoint
+ * - ownership is identical on every rank of comm
+ */
+template <class MemorySpace>
+struct DistributedMesh3D {
+  Mesh3D<MemorySpace> local;        // Rows owned by this rank
+  RowOwnership<MemorySpace> ownership;
+  MPI_Comm comm = MPI_COMM_WORLD;
+  int rank = 0;
+  int size = 1;
+};
+
+using DistributedMesh3DDevice = DistributedMesh3D<Kokkos::DefaultExecutionSpace::memory_space>;
+
+namespace detail {
+
+inline void mpi_check(int rc, const char* what) {
+  if (rc != MPI_SUCCESS) {
+    throw std::runtime_error(std::string("subsetix::distributed: ") + what + " failed");
+  }
+}
+
+/**
+ * @brief Rows of a mesh grouped by destination rank.
+ *
+ * Rows sent to rank p are rows[dest_ptr[p] .. dest_ptr[p+1]), ascending.
+ * A row may be sent to several ranks.
+ */
+template <class MemorySpace>
+struct RowRouting {
+  Kokkos::View<std::size_t*, MemorySpace> rows;
+  std::vector<std::size_t> dest_ptr;  // [num_ranks + 1]
+};
+
+/**
+ * @brief Group rows by destination.
+ *
+ * Destinations::operator()<Write>(i, out, offset) visits the destinations of
+ * row i, writing (dest << 32 | i) to out(offset + k) when Write is true, and
+ * returns their count. Duplicate destinations of a row are allowed.
+ */
+template <class ExecSpace, class MemorySpace, class Destinations>
+RowRouting<MemorySpace> route_rows(const ExecSpace& exec,
+                                   const Mesh3D<MemorySpace>& mesh,
+                                   std::size_t num_ranks,
+                                   const Destinations& destinations) {
+  using IndexView = Kokkos::View<std::size_t*, MemorySpace>;
+
+  const std::size_t n = mesh.num_rows;
+  if (n > std::numeric_limits<std::uint32_t>::max()) {
+    throw std::invalid_argument("subsetix::distributed: too many local rows to route");
+  }
+
+  RowRouting<MemorySpace> out;
+  out.dest_ptr.assign(num_ranks + 1, 0);
+  if (n == 0) {
+    out.rows = IndexView(Kokkos::view_alloc(exec, "routing_rows"), 0);
+    return out;
+  }
+
+  // Phase 1: Count (row, destination) pairs
+  IndexView counts(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "routing_counts"), n);
+  Kokkos::View<std::uint64_t*, MemorySpace> none;
+  Kokkos::parallel_for(
+      "routing_count",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, n),
+      KOKKOS_LAMBDA(const std::size_t i) {
+        counts(i) = destinations.template operator()<false>(i, none, 0);
+      });
+
+  IndexView offsets(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "routing_offsets"),
+                    n + 1);
+  const std::size_t total = subsetix::detail::exclusive_scan_csr_row_ptr<std::size_t>(
+      exec, "routing_scan", n, counts, offsets);
+
+  // Phase 2: Emit and sort by (destination, row)
+  Kokkos::View<std::uint64_t*, MemorySpace> pairs(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "routing_pairs"), total);
+  Kokkos::parallel_for(
+      "routing_fill",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, n),
+      KOKKOS_LAMBDA(const std::size_t i) {
+        destinations.template operator()<true>(i, pairs, offsets(i));
+      });
+  Kokkos::sort(exec, pairs);
+
+  // Phase 3: Drop duplicates and count rows per destination (host)
+  auto pairs_host = Kokkos::create_mirror_view(pairs);
+  Kokkos::deep_copy(exec, pairs_host, pairs);
+  exec.fence("routing_pairs");
+  std::vector<std::size_t> rows_host;
+  rows_host.reserve(total);
+  for (std::size_t k = 0; k < total; ++k) {
+    if (k > 0 && pairs_host(k) == pairs_host(k - 1)) {
+      continue;
+    }
+    const std::size_t dest = static_cast<std::size_t>(pairs_host(k) >> 32);
+    rows_host.push_back(static_cast<std::size_t>(pairs_host(k) & 0xFFFFFFFFULL));
+    ++out.dest_ptr[dest + 1];
+  }
+  for (std::size_t p = 0; p < num_ranks; ++p) {
+    out.dest_ptr[p + 1] += out.dest_ptr[p];
+  }
+
+  out.rows = IndexView(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "routing_rows"),
+                       rows_host.size());
+  auto rows_mirror = Kokkos::create_mirror_view(out.rows);
+  for (std::size_t k = 0; k < rows_host.size(); ++k) {
+    rows_mirror(k) = rows_host[k];
+  }
+  Kokkos::deep_copy(exec, out.rows, rows_mirror);
+  exec.fence("routing_rows");
+  return out;
+}
+
+template <class MemorySpace, class Destinations>
+RowRouting<MemorySpace> route_rows(const Mesh3D<MemorySpace>& mesh,
+                                   std::size_t num_ranks,
+                                   const Destinations& destinations) {
+  return route_rows(typename MemorySpace::execution_space(), mesh, num_ranks, destinations);
+}
+
+/**
+ * @brief Send every row to its owner (one destination per row).
+ */
+template <class MemorySpace>
+struct OwnerDestination {
+  typename Mesh3D<MemorySpace>::RowKeyView rows;
+  RowOwnership<MemorySpace> ownership;
+
+  template <bool Write>
+  KOKKOS_INLINE_FUNCTION
+  std::size_t operator()(std::size_t i,
+                         const Kokkos::View<std::uint64_t*, MemorySpace>& out,
+                         std::size_t offset) const {
+    if constexpr (Write) {
+      const auto dest = static_cast<std::uint64_t>(ownership.owner(rows(i).y, rows(i).z));
+      out(offset) = (dest << 32) | i;
+    }
+    return 1;
+  }
+};
+
+/**
+ * @brief Exchange a variable-size block of trivially copyable items with every rank.
+ *
+ * @param send Items, grouped by destination rank
+ * @param send_counts [num_ranks] - items sent to each rank
+ * @param recv_counts [num_ranks] - receives the items received from each rank
+ * @return Received items, grouped by source rank
+ */
+template <class T>
+std::vector<T> alltoallv_items(const T* send,
+                               const std::vector<std::size_t>& send_counts,
+                               std::vector<std::size_t>& recv_counts,
+                               MPI_Comm comm) {
+  const std::size_t p = send_counts.size();
+  std::vector<std::uint64_t> send_n(send_counts.begin(), send_counts.end());
+  std::vector<std::uint64_t> recv_n(p, 0);
+  mpi_check(MPI_Alltoall(send_n.data(), 1, MPI_UINT64_T, recv_n.data(), 1, MPI_UINT64_T, comm),
+            "MPI_Alltoall");
+
+  std::vector<int> scounts(p), sdispls(p), rcounts(p), rdispls(p);
+  std::size_t soff = 0;
+  std::size_t roff = 0;
+  for (std::size_t q = 0; q < p; ++q) {
+    const std::size_t sbytes = send_n[q] * sizeof(T);
+    const std::size_t rbytes = recv_n[q] * sizeof(T);
+    if (soff + sbytes > INT_MAX || roff + rbytes > INT_MAX) {
+      throw std::runtime_error("subsetix::distributed: exchange exceeds 2 GiB");
+    }
+    scounts[q] = static_cast<int>(sbytes);
+    sdispls[q] = static_cast<int>(soff);
+    rcounts[q] = static_cast<int>(rbytes);
+    rdispls[q] = static_cast<int>(roff);
+    soff += sbytes;
+    roff += rbytes;
+  }
+
+  recv_counts.assign(recv_n.begin(), recv_n.end());
+  std::vector<T> recv(roff / sizeof(T));
+  mpi_check(MPI_Alltoallv(send, scounts.data(), sdispls.data(), MPI_BYTE,
+                          recv.data(), rcounts.data(), rdispls.data(), MPI_BYTE, comm),
+            "MPI_Alltoallv");
+  return recv;
+}
+
+/**
+ * @brief Send groups of rows to other ranks.
+ *
+ * @param mesh Rows to send, grouped by destination (rows[dest_ptr[p] .. dest_ptr[p+1]) go to p)
+ * @param src_ptr [num_ranks + 1] - receives the row range of each source in the result
+ * @return Received rows, grouped by source rank (not canonical across groups)
+ */
+inline Mesh3DHost exchange_rows(const Mesh3DHost& mesh,
+                                const std::vector<std::size_t>& dest_ptr,
+                                std::vector<std::size_t>& src_ptr,
+                                MPI_Comm comm) {
+  const std::size_t p = dest_ptr.size() - 1;
+
+  std::vector<std::size_t> row_counts(p);
+  std::vector<std::size_t> interval_counts(p);
+  std::vector<std::uint64_t> lengths(mesh.num_rows);
+  for (std::size_t q = 0; q < p; ++q) {
+    row_counts[q] = dest_ptr[q + 1] - dest_ptr[q];
+    interval_counts[q] = (row_counts[q] == 0)
+                             ? 0
+                             : mesh.row_ptr(dest_ptr[q + 1]) - mesh.row_ptr(dest_ptr[q]);
+  }
+  for (std::size_t i = 0; i < mesh.num_rows; ++i) {
+    lengths[i] = mesh.row_ptr(i + 1) - mesh.row_ptr(i);
+  }
+
+  std::vector<std::size_t> recv_rows;
+  std::vector<std::size_t> recv_intervals;
+  const auto keys = alltoallv_items(mesh.row_keys.data(), row_counts, recv_rows, comm);
+  const auto lens = alltoallv_items(lengths.data(), row_counts, recv_rows, comm);
+  const auto ivs = alltoallv_items(mesh.intervals.data(), interval_counts, recv_intervals, comm);
+
+  src_ptr.assign(p + 1, 0);
+  for (std::size_t q = 0; q < p; ++q) {
+    src_ptr[q + 1] = src_ptr[q] + recv_rows[q];
+  }
+
+  Mesh3DHost out;
+  out.num_rows = keys.size();
+  out.num_intervals = ivs.size();
+  out.row_keys = Mesh3DHost::RowKeyView("mesh_row_keys", out.num_rows);
+  out.row_ptr = Mesh3DHost::IndexView("mesh_row_ptr", out.num_rows + 1);
+  out.intervals = Mesh3DHost::IntervalView("mesh_intervals", out.num_intervals);
+  for (std::size_t i = 0; i < out.num_rows; ++i) {
+    out.row_keys(i) = keys[i];
+    out.row_ptr(i + 1) = out.row_ptr(i) + lens[i];
+  }
+  for (std::size_t k = 0; k < out.num_intervals; ++k) {
+    out.intervals(k) = ivs[k];
+  }
+  return out;
+}
+
+/**
+ * @brief Sub-mesh made of the consecutive rows [begin, end).
+ */
+template <class ExecSpace, class MemorySpace>
+Mesh3D<MemorySpace> slice_rows(const ExecSpace& exec,
+                               const Mesh3D<MemorySpace>& mesh,
+                               std::size_t begin,
+                               std::size_t end) {
+  Kokkos::View<std::size_t*, MemorySpace> rows(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "slice_rows"), end - begin);
+  Kokkos::parallel_for(
+      "slice_rows_iota",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, end - begin),
+      KOKKOS_LAMBDA(const std::size_t i) { rows(i) = begin + i; });
+  return extract_rows(exec, mesh, rows);
+}
+
+template <class MemorySpace>
+Mesh3D<MemorySpace> slice_rows(const Mesh3D<MemorySpace>& mesh,
+                               std::size_t begin,
+                               std::size_t end) {
+  return slice_rows(typename MemorySpace::execution_space(), mesh, begin, end);
+}
+
+/**
+ * @brief Concatenate the rows of several meshes (no sorting, no merging).
+ */
+template <class ExecSpace, class MemorySpace>
+Mesh3D<MemorySpace> concat_meshes(const ExecSpace& exec,
+                                  const std::vector<Mesh3D<MemorySpace>>& parts) {
+  using MeshType = Mesh3D<MemorySpace>;
+
+  MeshType out;
+  for (const auto& part : parts) {
+    out.num_rows += part.num_rows;
+    out.num_intervals += part.num_intervals;
+  }
+  if (out.num_rows == 0) {
+    return MeshType{};
+  }
+
+  out.row_keys = typename MeshType::RowKeyView(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "mesh_row_keys"), out.num_rows);
+  out.row_ptr = typename MeshType::IndexView(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "mesh_row_ptr"), out.num_rows + 1);
+  out.intervals = typename MeshType::IntervalView(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "mesh_intervals"), out.num_intervals);
+
+  std::size_t row_base = 0;
+  std::size_t interval_base = 0;
+  for (const auto& part : parts) {
+    if (part.num_rows == 0) {
+      continue;
+    }
+    const auto rows = std::make_pair(row_base, row_base + part.num_rows);
+    const auto ivs = std::make_pair(interval_base, interval_base + part.num_intervals);
+    Kokkos::deep_copy(exec, Kokkos::subview(out.row_keys, rows), part.row_keys);
+    Kokkos::deep_copy(exec, Kokkos::subview(out.intervals, ivs),
+                      Kokkos::subview(part.intervals,
+                                      std::make_pair(std::size_t(0), part.num_intervals)));
+
+    auto src_ptr = part.row_ptr;
+    auto dst_ptr = out.row_ptr;
+    const std::size_t rb = row_base;
+    const std::size_t ib = interval_base;
+    Kokkos::parallel_for(
+        "concat_row_ptr",
+        Kokkos::RangePolicy<ExecSpace>(exec, 0, part.num_rows + 1),
+        KOKKOS_LAMBDA(const std::size_t i) { dst_ptr(rb + i) = ib + src_ptr(i); });
+
+    row_base += part.num_rows;
+    interval_base += part.num_intervals;
+  }
+  return out;
+}
+
+template <class MemorySpace>
+Mesh3D<MemorySpace> concat_meshes(const std::vector<Mesh3D<MemorySpace>>& parts) {
+  return concat_meshes(typename MemorySpace::execution_space(), parts);
+}
+
+/**
+ * @brief Restore the canonical (y, z) order of a mesh whose rows are unique but unsorted.
+ */
+template <class ExecSpace, class MemorySpace>
+Mesh3D<MemorySpace> sort_rows(const ExecSpace& exec, const Mesh3D<MemorySpace>& mesh) {
+  Kokkos::View<std::size_t*, MemorySpace> to_canonical;
+  Kokkos::View<std::size_t*, MemorySpace> from_canonical;
+  subsetix::detail::build_canonical_permutation(exec, mesh, to_canonical, from_canonical);
+  return extract_rows(exec, mesh, from_canonical);
+}
+
+template <class MemorySpace>
+Mesh3D<MemorySpace> sort_rows(const Mesh3D<MemorySpace>& mesh) {
+  return sort_rows(typename MemorySpace::execution_space(), mesh);
+}
+
+/**
+ * @brief Rows of a canonical mesh owned by a rank, ascending.
+ */
+template <class ExecSpace, class MemorySpace>
+Kokkos::View<std::size_t*, MemorySpace> owned_rows(const ExecSpace& exec,
+                                                  const Mesh3D<MemorySpace>& mesh,
+                                                  const RowOwnership<MemorySpace>& ownership,
+                                                  int rank) {
+  using IndexView = Kokkos::View<std::size_t*, MemorySpace>;
+
+  const std::size_t n = mesh.num_rows;
+  IndexView positions(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "owned_positions"),
+                      n);
+  Kokkos::View<std::size_t, MemorySpace> count_view(Kokkos::view_alloc(exec, "owned_count"));
+  auto rows = mesh.row_keys;
+  Kokkos::parallel_scan(
+      "distribute_owned_scan",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, n),
+      KOKKOS_LAMBDA(const std::size_t i, std::size_t& update, const bool final_pass) {
+        const std::size_t flag = (ownership.owner(rows(i).y, rows(i).z) == rank) ? 1 : 0;
+        if (final_pass) {
+          if (flag) {
+            positions(update) = i;
+          }
+          if (i + 1 == n) {
+            count_view() = update + flag;
+          }
+        }
+        update += flag;
+      });
+
+  std::size_t count = 0;
+  if (n > 0) {
+    Kokkos::deep_copy(exec, count, count_view);
+    exec.fence("distribute_owned_scan");
+  }
+  IndexView out(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "owned_rows"), count);
+  Kokkos::deep_copy(exec, out,
+                    Kokkos::subview(positions, std::make_pair(std::size_t(0), count)));
+  return out;
+}
+
+} // namespace detail
+
+/**
+ * @brief True if two ownership maps assign every row position to the same rank.
+ */
+template <class MemorySpace>
+bool same_ownership(const RowOwnership<MemorySpace>& a, const RowOwnership<MemorySpace>& b) {
+  if (a.curve != b.curve || a.anchor != b.anchor || a.num_ranks != b.num_ranks) {
+    return false;
+  }
+  auto ka = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, a.key_begin);
+  auto kb = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, b.key_begin);
+  for (std::size_t p = 0; p < a.num_ranks; ++p) {
+    if (ka(p) != kb(p)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Split a mesh replicated on every rank into balanced owned parts.
+ *
+ * Every rank computes the same curve partition (see subsetix::partition)
+ * and keeps its own rows, so no communication is needed.
+ *
+ * @param exec Execution space instance the operation is enqueued on
+ * @param global Full mesh, identical on every rank of comm
+ * @param comm Communicator; part p goes to rank p
+ * @param curve Space-filling curve used to order rows
+ */
+template <class ExecSpace, class MemorySpace>
+DistributedMesh3D<MemorySpace> distribute(const ExecSpace& exec,
+                                          const Mesh3D<MemorySpace>& global,
+                                          MPI_Comm comm,
+                                          CurveType curve = CurveType::Hilbert) {
+  DistributedMesh3D<MemorySpace> out;
+  out.comm = comm;
+  detail::mpi_check(MPI_Comm_rank(comm, &out.rank), "MPI_Comm_rank");
+  detail::mpi_check(MPI_Comm_size(comm, &out.size), "MPI_Comm_size");
+
+  const auto num_ranks = static_cast<std::size_t>(out.size);
+  const MeshPartition<MemorySpace> part = partition(exec, global, num_ranks, curve);
+
+  auto& own = out.ownership;
+  own.curve = curve;
+  own.num_ranks = num_ranks;
+  own.key_begin = Kokkos::View<std::uint64_t*, MemorySpace>(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "ownership_key_begin"), num_ranks);
+  auto key_begin = Kokkos::create_mirror_view(own.key_begin);
+
+  // Ownership starts at the curve key of the first row of each part
+  const std::size_t n = global.num_rows;
+  if (n > 0) {
+    own.anchor = subsetix::detail::curve_anchor(exec, global);
+    auto order = Kokkos::create_mirror_view(part.order);
+    auto rows = Kokkos::create_mirror_view(global.row_keys);
+    Kokkos::deep_copy(exec, order, part.order);
+    Kokkos::deep_copy(exec, rows, global.row_keys);
+    exec.fence("distribute_part_keys");
+    for (std::size_t p = 1; p < num_ranks; ++p) {
+      const std::size_t first = part.part_ptr[p];
+      key_begin(p) = (first < n)
+                         ? subsetix::detail::row_curve_key(curve, rows(order(first)).y,
+                                                           rows(order(first)).z,
+                                                           own.anchor.y, own.anchor.z)
+                         : std::numeric_limits<std::uint64_t>::max();
+    }
+  }
+  key_begin(0) = 0;
+  Kokkos::deep_copy(exec, own.key_begin, key_begin);
+
+  out.local = extract_rows(exec, global, detail::owned_rows(exec, global, own, out.rank));
+  exec.fence("distribute");
+  return out;
+}
+
+template <class MemorySpace>
+DistributedMesh3D<MemorySpace> distribute(const Mesh3D<MemorySpace>& global,
+                                          MPI_Comm comm,
+                                          CurveType curve = CurveType::Hilbert) {
+  return distribute(typename MemorySpace::execution_space(), global, comm, curve);
+}
+
+/**
+ * @brief Move the rows of a distributed mesh to the ranks of another ownership map.
+ *
+ * Collective over mesh.comm. Returns mesh unchanged when both maps agree;
+ * otherwise rows whose owner does not change stay on the device and only the
+ * rows bound for other ranks are staged through the host and exchanged.
+ * Device work is enqueued on exec.
+ */
+template <class ExecSpace, class MemorySpace>
+DistributedMesh3D<MemorySpace> redistribute(const ExecSpace& exec,
+                                            const DistributedMesh3D<MemorySpace>& mesh,
+                                            const RowOwnership<MemorySpace>& ownership) {
+  using intersection::v1::mesh_to;
+
+  DistributedMesh3D<MemorySpace> out;
+  out.comm = mesh.comm;
+  out.rank = mesh.rank;
+  out.size = mesh.size;
+  out.ownership = ownership;
+
+  if (same_ownership(mesh.ownership, ownership)) {
+    out.local = mesh.local;
+    return out;
+  }
+
+  const auto routing = detail::route_rows(
+      exec, mesh.local, ownership.num_ranks,
+      detail::OwnerDestination<MemorySpace>{mesh.local.row_keys, ownership});
+
+  const Mesh3D<MemorySpace> outgoing = extract_rows(exec, mesh.local, routing.rows);
+
+  // Split off the rows this rank keeps; the self segment of the exchange is empty
+  const std::size_t self = static_cast<std::size_t>(mesh.rank);
+  const std::size_t kept_begin = routing.dest_ptr[self];
+  const std::size_t kept_end = routing.dest_ptr[self + 1];
+  const Mesh3D<MemorySpace> kept = detail::slice_rows(exec, outgoing, kept_begin, kept_end);
+  const Mesh3D<MemorySpace> remote = detail::concat_meshes(
+      exec, std::vector<Mesh3D<MemorySpace>>{
+                detail::slice_rows(exec, outgoing, 0, kept_begin),
+                detail::slice_rows(exec, outgoing, kept_end, outgoing.num_rows)});
+  std::vector<std::size_t> send_ptr = routing.dest_ptr;
+  for (std::size_t q = self + 1; q < send_ptr.size(); ++q) {
+    send_ptr[q] -= kept_end - kept_begin;
+  }
+
+  // Outgoing rows must be complete before mesh_to reads them back
+  exec.fence("redistribute_extract");
+
+  std::vector<std::size_t> src_ptr;
+  const Mesh3DHost received = detail::exchange_rows(
+      mesh_to<Kokkos::HostSpace>(remote), send_ptr, src_ptr, mesh.comm);
+
+  out.local = detail::sort_rows(
+      exec, detail::concat_meshes(
+                exec, std::vector<Mesh3D<MemorySpace>>{kept, mesh_to<MemorySpace>(received)}));
+  exec.fence("redistribute");
+  return out;
+}
+
+template <class MemorySpace>
+DistributedMesh3D<MemorySpace> redistribute(const DistributedMesh3D<MemorySpace>& mesh,
+                                            const RowOwnership<MemorySpace>& ownership) {
+  return redistribute(typename MemorySpace::execution_space(), mesh, ownership);
+}
+
+/**
+ * @brief Intersection of two distributed meshes, owned like A.
+ *
+ * Intersection is row-local: when A and B share their ownership map no data
+ * moves at all; otherwise only the rows of B owned by another rank under
+ * A's map are sent. Device work is enqueued on exec.
+ */
+template <class ExecSpace, class MemorySpace>
+DistributedMesh3D<MemorySpace> intersect_meshes(const ExecSpace& exec,
+                                                const DistributedMesh3D<MemorySpace>& A,
+                                                const DistributedMesh3D<MemorySpace>& B) {
+  const DistributedMesh3D<MemorySpace> aligned = redistribute(exec, B, A.ownership);
+
+  DistributedMesh3D<MemorySpace> out;
+  out.comm = A.comm;
+  out.rank = A.rank;
+  out.size = A.size;
+  out.ownership = A.ownership;
+  out.local = intersection::v1::intersect_meshes(exec, A.local, aligned.local);
+  return out;
+}
+
+template <class MemorySpace>
+DistributedMesh3D<MemorySpace> intersect_meshes(const DistributedMesh3D<MemorySpace>& A,
+                                                const DistributedMesh3D<MemorySpace>& B) {
+  return intersect_meshes(typename MemorySpace::execution_space(), A, B);
+}
+
+} // namespace subsetix::distributed
@@ -0,0 +1,152 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/detail/utils.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <cstddef>
+#include <string>
+
+namespace subsetix {
+
+/**
+ * @brief Cell-centred field attached to a Mesh3D.
+ *
+ * Values are stored in mesh traversal order: row by row, interval by
+ * interval, and cell by cell along X inside each interval.
+ *
+ * Invariants:
+ * - interval_offsets.extent(0) == mesh.num_intervals + 1
+ * - interval_offsets(k) is the index of the first cell of interval k
+ * - interval_offsets(mesh.num_intervals) == num_cells
+ * - values.extent(0) >= num_cells
+ */
+template <class T, class MemorySpace>
+class Field3D {
+public:
+  using ValueView = Kokkos::View<T*, MemorySpace>;
+  using IndexView = Kokkos::View<std::size_t*, MemorySpace>;
+
+  ValueView values;           // [num_cells] - one value per cell
+  IndexView interval_offsets; // [num_intervals + 1] - cell offsets per interval
+
+  std::size_t num_cells = 0;
+
+  KOKKOS_INLINE_FUNCTION
+  Field3D() = default;
+
+  KOKKOS_INLINE_FUNCTION
+  Field3D(const Field3D&) = default;
+
+  KOKKOS_INLINE_FUNCTION
+  Field3D& operator=(const Field3D&) = default;
+};
+
+template <class T>
+using Field3DDevice = Field3D<T, Kokkos::DefaultExecutionSpace::memory_space>;
+template <class T>
+using Field3DHost = Field3D<T, Kokkos::HostSpace>;
+
+/**
+ * @brief Field paired with the name it is exported under (I/O, checkpoints).
+ */
+template <class T, class MemorySpace>
+struct NamedField {
+  std::string name;
+  Field3D<T, MemorySpace> field;
+};
+
+/**
+ * @brief Compute the cell offset of every interval of a mesh.
+ *
+ * Writes offsets(k) = number of cells in intervals [0, k) and
+ * offsets(num_intervals) = total number of cells.
+ *
+ * @param exec Execution space instance the kernels are enqueued on
+ * @return Total number of cells in the mesh
+ */
+template <class ExecSpace, class MemorySpace>
+std::size_t compute_interval_cell_offsets(
+    const ExecSpace& exec,
+    const Mesh3D<MemorySpace>& mesh,
+    Kokkos::View<std::size_t*, MemorySpace>& offsets) {
+  const std::size_t n = mesh.num_intervals;
+
+  offsets = Kokkos::View<std::size_t*, MemorySpace>(
+      Kokkos::view_alloc(exec, "interval_cell_offsets"), n + 1);
+  if (n == 0) {
+    exec.fence("field_interval_offsets");
+    return 0;
+  }
+
+  Kokkos::View<std::size_t*, MemorySpace> sizes(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "interval_sizes"), n);
+  auto intervals = mesh.intervals;
+  Kokkos::parallel_for(
+      "field_interval_sizes",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, n),
+      KOKKOS_LAMBDA(const std::size_t k) {
+        sizes(k) = static_cast<std::size_t>(intervals(k).size());
+      });
+
+  return detail::exclusive_scan_csr_row_ptr<std::size_t>(
+      exec, "field_interval_offsets", n, sizes, offsets);
+}
+
+template <class MemorySpace>
+std::size_t compute_interval_cell_offsets(
+    const Mesh3D<MemorySpace>& mesh,
+    Kokkos::View<std::size_t*, MemorySpace>& offsets) {
+  return compute_interval_cell_offsets(typename MemorySpace::execution_space(), mesh, offsets);
+}
+
+/**
+ * @brief Count the cells of a mesh (sum of interval lengths).
+ */
+template <class ExecSpace, class MemorySpace>
+std::size_t count_cells(const ExecSpace& exec, const Mesh3D<MemorySpace>& mesh) {
+  std::size_t total = 0;
+  auto intervals = mesh.intervals;
+  Kokkos::parallel_reduce(
+      "mesh_count_cells",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, mesh.num_intervals),
+      KOKKOS_LAMBDA(const std::size_t k, std::size_t& sum) {
+        sum += static_cast<std::size_t>(intervals(k).size());
+      },
+      total);
+  return total;
+}
+
+template <class MemorySpace>
+std::size_t count_cells(const Mesh3D<MemorySpace>& mesh) {
+  return count_cells(typename MemorySpace::execution_space(), mesh);
+}
+
+/**
+ * @brief Allocate a zero-initialised field laid out on a mesh.
+ */
+template <class T, class MemorySpace>
+Field3D<T, MemorySpace> make_field(const Mesh3D<MemorySpace>& mesh,
+                                   const std::string& label) {
+  Field3D<T, MemorySpace> field;
+  field.num_cells = compute_interval_cell_offsets(mesh, field.interval_offsets);
+  field.values = typename Field3D<T, MemorySpace>::ValueView(label, field.num_cells);
+  return field;
+}
+
+/**
+ * @brief Convert a field between memory spaces (e.g., Device -> Host).
+ */
+template <class ToSpace, class T, class FromSpace>
+Field3D<T, ToSpace> field_to(const Field3D<T, FromSpace>& src) {
+  Field3D<T, ToSpace> dst;
+  dst.num_cells = src.num_cells;
+  dst.values = Kokkos::create_mirror_view_and_copy(ToSpace{}, src.values);
+  dst.interval_offsets = Kokkos::create_mirror_view_and_copy(ToSpace{}, src.interval_offsets);
+  return dst;
+}
+
+} // namespace subsetix
@@ -0,0 +1,549 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/detail/utils.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+namespace subsetix::generators {
+
+/**
+ * @brief Candidate rows [y_begin, y_end) x [z_begin, z_end) of a family.
+ */
+struct RowBox {
+  Coord y_begin = 0;
+  Coord y_end = 0;
+  Coord z_begin = 0;
+  Coord z_end = 0;
+};
+
+namespace detail {
+
+/**
+ * @brief SplitMix64 finaliser, used as a stateless per-row random source.
+ */
+KOKKOS_INLINE_FUNCTION
+std::uint64_t mix64(std::uint64_t x) {
+  x += 0x9E3779B97F4A7C15ULL;
+  x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+  return x ^ (x >> 31);
+}
+
+KOKKOS_INLINE_FUNCTION
+std::uint64_t hash_coords(std::uint64_t seed, Coord a, Coord b, Coord c) {
+  std::uint64_t h = mix64(seed ^ static_cast<std::uint32_t>(a));
+  h = mix64(h ^ static_cast<std::uint32_t>(b));
+  return mix64(h ^ static_cast<std::uint32_t>(c));
+}
+
+/**
+ * @brief Uniform double in [0, 1) from the top 53 bits of h.
+ */
+KOKKOS_INLINE_FUNCTION
+double unit_double(std::uint64_t h) {
+  return static_cast<double>(h >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/**
+ * @brief floor(sqrt(v)) for v >= 0, exact for 64-bit inputs.
+ */
+KOKKOS_INLINE_FUNCTION
+std::int64_t isqrt(std::int64_t v) {
+  std::int64_t r = static_cast<std::int64_t>(Kokkos::sqrt(static_cast<double>(v)));
+  while (r > 0 && r * r > v) {
+    --r;
+  }
+  while ((r + 1) * (r + 1) <= v) {
+    ++r;
+  }
+  return r;
+}
+
+/**
+ * @brief Write (unless CountOnly) the interval [begin, end) at out(offset + count).
+ */
+template <bool CountOnly, class IntervalView>
+KOKKOS_INLINE_FUNCTION
+void emit(const IntervalView& out, std::size_t offset, std::size_t& count, Coord begin, Coord end) {
+  if constexpr (!CountOnly) {
+    out(offset + count) = Interval{begin, end};
+  }
+  ++count;
+}
+
+} // namespace detail
+
+// ============================================================================
+// Families
+// ============================================================================
+//
+// Each family exposes rows() (host) and a device row<CountOnly>(y, z, out,
+// offset) that returns the number of intervals of row (y, z) and, unless
+// CountOnly, writes them sorted at out(offset ...).
+
+/**
+ * @brief Cells with r_inner^2 <= |p - c|^2 < r_outer^2 around c = (center)^3.
+ *
+ * Rows crossing the hole hold two intervals, the others one.
+ */
+struct SphereShell {
+  Coord center = 0;
+  Coord r_inner = 0;
+  Coord r_outer = 0;
+
+  RowBox rows() const {
+    return {center - r_outer, center + r_outer + 1, center - r_outer, center + r_outer + 1};
+  }
+
+  template <bool CountOnly, class IntervalView>
+  KOKKOS_INLINE_FUNCTION
+  std::size_t row(Coord y, Coord z, const IntervalView& out, std::size_t offset) const {
+    const std::int64_t dy = y - center;
+    const std::int64_t dz = z - center;
+    const std::int64_t d2 = dy * dy + dz * dz;
+    const std::int64_t outer = static_cast<std::int64_t>(r_outer) * r_outer - d2;
+    const std::int64_t inner = static_cast<std::int64_t>(r_inner) * r_inner - d2;
+
+    std::size_t count = 0;
+    if (outer < 1) {
+      return count;
+    }
+    const Coord ho = static_cast<Coord>(detail::isqrt(outer - 1));
+    if (inner < 1) {
+      detail::emit<CountOnly>(out, offset, count, center - ho, center + ho + 1);
+      return count;
+    }
+    const Coord hi = static_cast<Coord>(detail::isqrt(inner - 1));
+    if (hi < ho) {
+      detail::emit<CountOnly>(out, offset, count, center - ho, center - hi);
+      detail::emit<CountOnly>(out, offset, count, center + hi + 1, center + ho + 1);
+    }
+    return count;
+  }
+};
+
+/**
+ * @brief Sparse random boxes in [0, extent)^3, at most one per tile^3 tile.
+ *
+ * A tile holds a box with probability fill; the box bounds inside the tile
+ * are drawn from seed, so boxes never overlap and rows need no merge.
+ */
+struct RandomBoxes {
+  Coord extent = 0;
+  Coord tile = 1;  // >= 1
+  double fill = 0.1;
+  std::uint64_t seed = 0;
+
+  void validate() const {
+    if (tile < 1) {
+      throw std::invalid_argument("RandomBoxes: tile must be at least 1");
+    }
+  }
+
+  RowBox rows() const {
+    const Coord used = (extent / tile) * tile;
+    return {0, used, 0, used};
+  }
+
+  // Bounds [lo, hi) of the box of a tile along axis, in tile-local coordinates
+  KOKKOS_INLINE_FUNCTION
+  void box_axis(std::uint64_t h, int axis, Coord& lo, Coord& hi) const {
+    const std::uint64_t a = detail::mix64(h + static_cast<std::uint64_t>(axis) + 1);
+    lo = static_cast<Coord>(a % static_cast<std::uint64_t>(tile));
+    hi = lo + 1 + static_cast<Coord>((a >> 32) % static_cast<std::uint64_t>(tile - lo));
+  }
+
+  template <bool CountOnly, class IntervalView>
+  KOKKOS_INLINE_FUNCTION
+  std::size_t row(Coord y, Coord z, const IntervalView& out, std::size_t offset) const {
+    const Coord tiles = extent / tile;
+    const Coord ty = y / tile;
+    const Coord tz = z / tile;
+    std::size_t count = 0;
+    for (Coord tx = 0; tx < tiles; ++tx) {
+      const std::uint64_t h = detail::hash_coords(seed, tx, ty, tz);
+      if (detail::unit_double(h) >= fill) {
+        continue;
+      }
+      Coord lo = 0;
+      Coord hi = 0;
+      box_axis(h, 1, lo, hi);
+      if (y - ty * tile < lo || y - ty * tile >= hi) {
+        continue;
+      }
+      box_axis(h, 2, lo, hi);
+      if (z - tz * tile < lo || z - tz * tile >= hi) {
+        continue;
+      }
+      box_axis(h, 0, lo, hi);
+      detail::emit<CountOnly>(out, offset, count, tx * tile + lo, tx * tile + hi);
+    }
+    return count;
+  }
+};
+
+/**
+ * @brief Fragmented rows: intervals of length with gaps of gap in [0, extent)^3.
+ *
+ * Every row is shifted by a random phase in [0, length + gap).
+ */
+struct StripedRows {
+  Coord extent = 0;
+  Coord length = 1;  // >= 1
+  Coord gap = 1;     // >= 1: touching intervals would not be canonical
+  std::uint64_t seed = 0;
+
+  void validate() const {
+    if (length < 1 || gap < 1) {
+      throw std::invalid_argument("StripedRows: length and gap must be at least 1");
+    }
+    if (length > std::numeric_limits<Coord>::max() - gap) {
+      throw std::invalid_argument("StripedRows: length + gap overflows Coord");
+    }
+  }
+
+  RowBox rows() const { return {0, extent, 0, extent}; }
+
+  template <bool CountOnly, class IntervalView>
+  KOKKOS_INLINE_FUNCTION
+  std::size_t row(Coord y, Coord z, const IntervalView& out, std::size_t offset) const {
+    const Coord period = length + gap;
+    const Coord phase = static_cast<Coord>(detail::hash_coords(seed, y, z, 0) %
+                                           static_cast<std::uint64_t>(period));
+    std::size_t count = 0;
+    for (Coord s = phase; s < extent; s += period) {
+      const Coord e = (s + length < extent) ? s + length : extent;
+      detail::emit<CountOnly>(out, offset, count, s, e);
+    }
+    return count;
+  }
+};
+
+/**
+ * @brief Menger sponge of the given level in [0, 3^level)^3 (20^level cells).
+ *
+ * A cell is removed when two of its base-3 digits at the same position are 1.
+ */
+struct MengerSponge {
+  int level = 1;
+
+  Coord extent() const {
+    Coord n = 1;
+    for (int l = 0; l < level; ++l) {
+      n *= 3;
+    }
+    return n;
+  }
+
+  RowBox rows() const { return {0, extent(), 0, extent()}; }
+
+  template <bool CountOnly, class IntervalView>
+  KOKKOS_INLINE_FUNCTION
+  std::size_t row(Coord y, Coord z, const IntervalView& out, std::size_t offset) const {
+    // Digit positions where x must not be 1; row empty if y and z share a 1
+    Coord n = 1;
+    std::uint32_t forbidden = 0;
+    Coord yy = y;
+    Coord zz = z;
+    for (int l = 0; l < level; ++l) {
+      const bool y1 = (yy % 3) == 1;
+      const bool z1 = (zz % 3) == 1;
+      if (y1 && z1) {
+        return 0;
+      }
+      if (y1 || z1) {
+        forbidden |= 1U << l;
+      }
+      yy /= 3;
+      zz /= 3;
+      n *= 3;
+    }
+
+    std::size_t count = 0;
+    Coord run = -1;
+    for (Coord x = 0; x <= n; ++x) {
+      bool in = x < n;
+      Coord xx = x;
+      for (int l = 0; in && l < level; ++l) {
+        in = !((forbidden >> l) & 1U) || (xx % 3) != 1;
+        xx /= 3;
+      }
+      if (in && run < 0) {
+        run = x;
+      } else if (!in && run >= 0) {
+        detail::emit<CountOnly>(out, offset, count, run, x);
+        run = -1;
+      }
+    }
+    return count;
+  }
+};
+
+/**
+ * @brief Rows whose interval counts follow a power law (Pareto, exponent alpha).
+ *
+ * Row (y, z) of [0, extent)^2 holds min(max_intervals, floor(u^(-1/alpha)))
+ * intervals of length 2 with unit gaps, so a few rows are much longer than
+ * the rest.
+ */
+struct PowerLawRows {
+  Coord extent = 0;
+  double alpha = 1.5;          // > 0
+  Coord max_intervals = 1024;  // >= 0, intervals end before 3 * max_intervals + 2
+  std::uint64_t seed = 0;
+
+  void validate() const {
+    if (!(alpha > 0.0)) {
+      throw std::invalid_argument("PowerLawRows: alpha must be positive");
+    }
+    if (max_intervals < 0 || max_intervals > (std::numeric_limits<Coord>::max() - 4) / 3) {
+      throw std::invalid_argument("PowerLawRows: max_intervals out of range");
+    }
+  }
+
+  RowBox rows() const { return {0, extent, 0, extent}; }
+
+  template <bool CountOnly, class IntervalView>
+  KOKKOS_INLINE_FUNCTION
+  std::size_t row(Coord y, Coord z, const IntervalView& out, std::size_t offset) const {
+    const std::uint64_t h = detail::hash_coords(seed, y, z, 0);
+    const double u = 1.0 - detail::unit_double(h);  // (0, 1]
+    const double draw = Kokkos::pow(u, -1.0 / alpha);
+    const Coord n = (draw >= static_cast<double>(max_intervals)) ? max_intervals
+                                                                 : static_cast<Coord>(draw);
+    const Coord phase = static_cast<Coord>(detail::mix64(h) % 3);
+    std::size_t count = 0;
+    for (Coord k = 0; k < n; ++k) {
+      detail::emit<CountOnly>(out, offset, count, phase + 3 * k, phase + 3 * k + 2);
+    }
+    return count;
+  }
+};
+
+/**
+ * @brief Dense box [lo, hi) on every axis: one full-width interval per row.
+ */
+struct Box {
+  Coord lo[3] = {0, 0, 0};
+  Coord hi[3] = {0, 0, 0};
+
+  RowBox rows() const { return {lo[1], hi[1], lo[2], hi[2]}; }
+
+  template <bool CountOnly, class IntervalView>
+  KOKKOS_INLINE_FUNCTION
+  std::size_t row(Coord, Coord, const IntervalView& out, std::size_t offset) const {
+    std::size_t count = 0;
+    if (lo[0] < hi[0]) {
+      detail::emit<CountOnly>(out, offset, count, lo[0], hi[0]);
+    }
+    return count;
+  }
+};
+
+// Cube [0, n)^3
+inline Box cube(Coord n) {
+  return Box{{0, 0, 0}, {n, n, n}};
+}
+
+/**
+ * @brief Leaf cells of one level of an AMR-like hierarchy of nested boxes.
+ *
+ * Built by amr_level(); the level box minus the footprint of the next finer
+ * level, in the index space of this level.
+ */
+struct AmrLevel {
+  Coord lo[3] = {0, 0, 0};
+  Coord hi[3] = {0, 0, 0};
+  Coord hole_lo[3] = {0, 0, 0};
+  Coord hole_hi[3] = {0, 0, 0};  // empty hole when hole_lo == hole_hi
+
+  RowBox rows() const { return {lo[1], hi[1], lo[2], hi[2]}; }
+
+  template <bool CountOnly, class IntervalView>
+  KOKKOS_INLINE_FUNCTION
+  std::size_t row(Coord y, Coord z, const IntervalView& out, std::size_t offset) const {
+    std::size_t count = 0;
+    const bool in_hole = y >= hole_lo[1] && y < hole_hi[1] && z >= hole_lo[2] && z < hole_hi[2] &&
+                         hole_lo[0] < hole_hi[0];
+    if (!in_hole) {
+      detail::emit<CountOnly>(out, offset, count, lo[0], hi[0]);
+      return count;
+    }
+    if (lo[0] < hole_lo[0]) {
+      detail::emit<CountOnly>(out, offset, count, lo[0], hole_lo[0]);
+    }
+    if (hole_hi[0] < hi[0]) {
+      detail::emit<CountOnly>(out, offset, count, hole_hi[0], hi[0]);
+    }
+    return count;
+  }
+};
+
+/**
+ * @brief Level `level` of a hierarchy of num_levels nested boxes.
+ *
+ * Level 0 covers [0, extent)^3. Each finer level refines (factor 2) a
+ * sub-box of half the extent of its parent, placed from seed.
+ *
+ * @throws std::invalid_argument if level is not in [0, num_levels)
+ */
+inline AmrLevel amr_level(Coord extent, int num_levels, int level, std::uint64_t seed) {
+  if (level < 0 || level >= num_levels) {
+    throw std::invalid_argument("amr_level: level out of range");
+  }
+
+  AmrLevel out;
+  for (int a = 0; a < 3; ++a) {
+    out.hi[a] = extent;
+  }
+  for (int l = 0; l <= level; ++l) {
+    // Footprint of level l + 1 in the index space of level l
+    Coord child_lo[3] = {0, 0, 0};
+    Coord child_hi[3] = {0, 0, 0};
+    const bool refined = l + 1 < num_levels;
+    for (int a = 0; refined && a < 3; ++a) {
+      const Coord size = out.hi[a] - out.lo[a];
+      const Coord len = (size / 2 > 0) ? size / 2 : 1;
+      const std::uint64_t h = detail::hash_coords(seed, l, a, 0);
+      child_lo[a] = out.lo[a] + static_cast<Coord>(h % static_cast<std::uint64_t>(size - len + 1));
+      child_hi[a] = child_lo[a] + len;
+    }
+    if (l == level) {
+      for (int a = 0; a < 3; ++a) {
+        out.hole_lo[a] = child_lo[a];
+        out.hole_hi[a] = child_hi[a];
+      }
+    } else {
+      for (int a = 0; a < 3; ++a) {
+        out.lo[a] = 2 * child_lo[a];
+        out.hi[a] = 2 * child_hi[a];
+      }
+    }
+  }
+  return out;
+}
+
+// ============================================================================
+// Generation
+// ============================================================================
+
+/**
+ * @brief Build the mesh of a family directly in MemorySpace.
+ *
+ * Two passes over the candidate rows of family.rows(): count, then fill at
+ * scanned offsets; empty rows are dropped. The result is canonical and
+ * depends only on the family parameters (seeds included). Families with a
+ * validate() member are checked on the host before any kernel runs.
+ *
+ * @param exec Execution space instance the kernels are enqueued on
+ * @param family One of the families above (or any type with the same interface)
+ * @throws std::invalid_argument if family.validate() rejects the parameters
+ */
+template <class MemorySpace, class ExecSpace, class Family>
+Mesh3D<MemorySpace> generate(const ExecSpace& exec, const Family& family) {
+  using MeshType = Mesh3D<MemorySpace>;
+  using IndexView = typename MeshType::IndexView;
+
+  if constexpr (requires { family.validate(); }) {
+    family.validate();
+  }
+  const RowBox box = family.rows();
+  const std::size_t ny = (box.y_end > box.y_begin) ? std::size_t(box.y_end - box.y_begin) : 0;
+  const std::size_t nz = (box.z_end > box.z_begin) ? std::size_t(box.z_end - box.z_begin) : 0;
+  const std::size_t n = ny * nz;
+  if (n == 0) {
+    return MeshType{};
+  }
+
+  // Pass 1: Interval count of every candidate row
+  IndexView counts(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "generate_counts"), n);
+  Kokkos::parallel_for(
+      "generate_count",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, n),
+      KOKKOS_LAMBDA(const std::size_t r) {
+        const Coord y = box.y_begin + static_cast<Coord>(r / nz);
+        const Coord z = box.z_begin + static_cast<Coord>(r % nz);
+        counts(r) = family.template row<true>(y, z, typename MeshType::IntervalView(), 0);
+      });
+
+  IndexView offsets(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "generate_offsets"),
+                    n + 1);
+  const std::size_t total = subsetix::detail::exclusive_scan_csr_row_ptr<std::size_t>(
+      exec, "generate_offsets", n, counts, offsets);
+  if (total == 0) {
+    return MeshType{};
+  }
+
+  IndexView positions(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "generate_positions"),
+                      n);
+  Kokkos::View<std::size_t, MemorySpace> num_rows_view(
+      Kokkos::view_alloc(exec, "generate_num_rows"));
+  Kokkos::parallel_scan(
+      "generate_row_scan",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, n),
+      KOKKOS_LAMBDA(const std::size_t r, std::size_t& update, const bool final_pass) {
+        const std::size_t kept = (counts(r) > 0) ? 1 : 0;
+        if (final_pass) {
+          positions(r) = update;
+          if (r + 1 == n) {
+            num_rows_view() = update + kept;
+          }
+        }
+        update += kept;
+      });
+
+  std::size_t num_rows = 0;
+  Kokkos::deep_copy(exec, num_rows, num_rows_view);
+  exec.fence("generate_row_scan");
+
+  // Pass 2: Fill kept rows
+  MeshType out;
+  out.num_rows = num_rows;
+  out.num_intervals = total;
+  out.row_keys = typename MeshType::RowKeyView(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "mesh_row_keys"), num_rows);
+  out.row_ptr = IndexView(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "mesh_row_ptr"),
+                          num_rows + 1);
+  out.intervals = typename MeshType::IntervalView(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "mesh_intervals"), total);
+
+  auto keys = out.row_keys;
+  auto ptr = out.row_ptr;
+  auto intervals = out.intervals;
+  Kokkos::parallel_for(
+      "generate_fill",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, n),
+      KOKKOS_LAMBDA(const std::size_t r) {
+        if (counts(r) == 0) {
+          return;
+        }
+        const Coord y = box.y_begin + static_cast<Coord>(r / nz);
+        const Coord z = box.z_begin + static_cast<Coord>(r % nz);
+        const std::size_t pos = positions(r);
+        keys(pos) = RowKey{y, z};
+        ptr(pos) = offsets(r);
+        family.template row<false>(y, z, intervals, offsets(r));
+      });
+  Kokkos::deep_copy(exec, Kokkos::subview(ptr, num_rows), total);
+  exec.fence("generate_fill");
+
+  return out;
+}
+
+/**
+ * @brief Build the mesh of a family on the default instance of MemorySpace.
+ */
+template <class MemorySpace = Kokkos::DefaultExecutionSpace::memory_space, class Family>
+Mesh3D<MemorySpace> generate(const Family& family) {
+  return generate<MemorySpace>(typename MemorySpace::execution_space(), family);
+}
+
+} // namespace subsetix::generators
@@ -0,0 +1,220 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/profiling.hpp>
+#include <subsetix/batch.hpp>
+#include <subsetix/detail/utils.hpp>
+#include <subsetix/intersection/v1.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace subsetix::intersection::v1 {
+
+namespace detail {
+
+// idx_b entry of a row of A without a matching row in B
+constexpr std::size_t batch_no_row = std::numeric_limits<std::size_t>::max();
+
+/**
+ * @brief Rows [base, base + n) of a flat row view, indexable from 0.
+ */
+template <class RowKeyView>
+struct RowRange {
+  RowKeyView rows;
+  std::size_t base = 0;
+
+  KOKKOS_INLINE_FUNCTION
+  RowKey operator()(std::size_t i) const { return rows(base + i); }
+};
+
+} // namespace detail
+
+/**
+ * @brief Intersect mesh m of A with mesh m of B, for every m, in one pass.
+ *
+ * Each phase is a single launch over all rows of all pairs, so the cost of
+ * many small intersections is no longer dominated by launches and fences.
+ *
+ * Algorithm:
+ * 1. Count - per row of A: pair lookup, row lookup in the pair's B rows,
+ *    intersected interval count
+ * 2. Scan - kept-row positions and interval offsets, across all pairs
+ * 3. Fill - write rows, CSR offsets, intervals and per-pair row ranges
+ *
+ * @param exec Execution space instance the operation is enqueued on
+ * @param A First meshes of the pairs
+ * @param B Second meshes of the pairs
+ * @return Batch whose mesh m is the intersection of pair m
+ * @throws std::invalid_argument if A and B hold different numbers of meshes
+ */
+template <class ExecSpace, class MemorySpace>
+MeshBatch<MemorySpace> intersect_batch(const ExecSpace& exec,
+                                       const MeshBatch<MemorySpace>& A,
+                                       const MeshBatch<MemorySpace>& B) {
+  using Batch = MeshBatch<MemorySpace>;
+  using IndexView = typename Batch::IndexView;
+
+  if (A.num_meshes != B.num_meshes) {
+    throw std::invalid_argument("intersect_batch: A and B hold different numbers of meshes");
+  }
+
+  const profiling::ScopedRegion<ExecSpace> op_region(exec, "intersect_batch");
+
+  const std::size_t num_pairs = A.num_meshes;
+  const std::size_t n = A.num_rows;
+
+  Batch out;
+  out.num_meshes = num_pairs;
+  out.mesh_row_ptr = IndexView(Kokkos::view_alloc(exec, "batch_mesh_row_ptr"), num_pairs + 1);
+
+  auto rows_a = A.row_keys;
+  auto ptr_a = A.row_ptr;
+  auto intervals_a = A.intervals;
+  auto mesh_ptr_a = A.mesh_row_ptr;
+  auto rows_b = B.row_keys;
+  auto ptr_b = B.row_ptr;
+  auto intervals_b = B.intervals;
+  auto mesh_ptr_b = B.mesh_row_ptr;
+
+  // Phase 1: Row lookup and interval counts for every row of every pair
+  Kokkos::View<std::size_t*, MemorySpace> idx_b(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "batch_idx_b"), n);
+  IndexView counts(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "batch_counts"), n);
+  Kokkos::parallel_for(
+      "intersect_batch_count",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, n),
+      KOKKOS_LAMBDA(const std::size_t i) {
+        const std::size_t p = subsetix::detail::find_segment(mesh_ptr_a, num_pairs, i);
+        const std::size_t base = mesh_ptr_b(p);
+        const std::size_t num_b = mesh_ptr_b(p + 1) - base;
+        const RowKey key = rows_a(i);
+        const detail::RowRange<typename Batch::RowKeyView> range{rows_b, base};
+        const std::size_t local = subsetix::detail::lower_bound_row(range, num_b, key);
+        const std::size_t ib =
+            (local < num_b && range(local) == key) ? base + local : detail::batch_no_row;
+
+        idx_b(i) = ib;
+        counts(i) = (ib == detail::batch_no_row)
+                        ? 0
+                        : detail::row_intersection_impl<detail::CountIntervals>(
+                              intervals_a, ptr_a(i), ptr_a(i + 1),
+                              intervals_b, ptr_b(ib), ptr_b(ib + 1));
+      });
+
+  // Phase 2: Positions of kept rows and their interval offsets
+  IndexView row_pos(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "batch_row_pos"),
+                    n + 1);
+  IndexView interval_pos(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "batch_interval_pos"), n + 1);
+  Kokkos::parallel_scan(
+      "intersect_batch_row_scan",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, n + 1),
+      KOKKOS_LAMBDA(const std::size_t i, std::size_t& update, const bool final_pass) {
+        const std::size_t kept = (i < n && counts(i) > 0) ? 1 : 0;
+        if (final_pass) {
+          row_pos(i) = update;
+        }
+        update += kept;
+      });
+  Kokkos::parallel_scan(
+      "intersect_batch_interval_scan",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, n + 1),
+      KOKKOS_LAMBDA(const std::size_t i, std::size_t& update, const bool final_pass) {
+        const std::size_t count = (i < n) ? counts(i) : 0;
+        if (final_pass) {
+          interval_pos(i) = update;
+        }
+        update += count;
+      });
+
+  Kokkos::deep_copy(exec, out.num_rows, Kokkos::subview(row_pos, n));
+  Kokkos::deep_copy(exec, out.num_intervals, Kokkos::subview(interval_pos, n));
+  exec.fence("intersect_batch_scan");
+
+  // Phase 3: Fill rows, offsets, intervals and pair ranges
+  out.row_keys = typename Batch::RowKeyView(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "batch_row_keys"), out.num_rows);
+  out.row_ptr = IndexView(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "batch_row_ptr"),
+                          out.num_rows + 1);
+  out.intervals = typename Batch::IntervalView(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "batch_intervals"),
+      out.num_intervals);
+
+  auto out_keys = out.row_keys;
+  auto out_ptr = out.row_ptr;
+  auto out_intervals = out.intervals;
+  auto out_mesh_ptr = out.mesh_row_ptr;
+  const std::size_t num_rows_out = out.num_rows;
+  const std::size_t num_intervals_out = out.num_intervals;
+  Kokkos::parallel_for(
+      "intersect_batch_fill",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, n),
+      KOKKOS_LAMBDA(const std::size_t i) {
+        if (counts(i) == 0) {
+          return;
+        }
+        const std::size_t pos = row_pos(i);
+        const std::size_t ib = idx_b(i);
+        out_keys(pos) = rows_a(i);
+        out_ptr(pos) = interval_pos(i);
+        detail::row_intersection_impl<detail::WriteIntervals>(
+            intervals_a, ptr_a(i), ptr_a(i + 1),
+            intervals_b, ptr_b(ib), ptr_b(ib + 1),
+            out_intervals, interval_pos(i));
+      });
+
+  Kokkos::parallel_for(
+      "intersect_batch_ranges",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, num_pairs + 1),
+      KOKKOS_LAMBDA(const std::size_t p) {
+        out_mesh_ptr(p) = row_pos(mesh_ptr_a(p));
+        if (p == num_pairs) {
+          out_ptr(num_rows_out) = num_intervals_out;
+        }
+      });
+
+  return out;
+}
+
+template <class MemorySpace>
+MeshBatch<MemorySpace> intersect_batch(const MeshBatch<MemorySpace>& A,
+                                       const MeshBatch<MemorySpace>& B) {
+  return intersect_batch(typename MemorySpace::execution_space(), A, B);
+}
+
+/**
+ * @brief Intersect many mesh pairs in one pass (see intersect_batch on batches).
+ *
+ * The inputs are packed with make_batch (one gather kernel per side); use
+ * unbatch(result, p) to get the intersection of pair p as a Mesh3D.
+ */
+template <class ExecSpace, class MemorySpace>
+MeshBatch<MemorySpace> intersect_batch(
+    const ExecSpace& exec,
+    const std::vector<std::pair<Mesh3D<MemorySpace>, Mesh3D<MemorySpace>>>& pairs) {
+  std::vector<Mesh3D<MemorySpace>> first;
+  std::vector<Mesh3D<MemorySpace>> second;
+  first.reserve(pairs.size());
+  second.reserve(pairs.size());
+  for (const auto& pair : pairs) {
+    first.push_back(pair.first);
+    second.push_back(pair.second);
+  }
+  return intersect_batch(exec, make_batch(exec, first), make_batch(exec, second));
+}
+
+template <class MemorySpace>
+MeshBatch<MemorySpace> intersect_batch(
+    const std::vector<std::pair<Mesh3D<MemorySpace>, Mesh3D<MemorySpace>>>& pairs) {
+  return intersect_batch(typename MemorySpace::execution_space(), pairs);
+}
+
+} // namespace subsetix::intersection::v1
@@ -0,0 +1,280 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/profiling.hpp>
+#include <subsetix/partition.hpp>
+#include <subsetix/detail/utils.hpp>
+#include <subsetix/intersection/v1.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+namespace subsetix::intersection::v1 {
+
+/**
+ * @brief Inclusive band of row keys [first, last] in (y, z) order.
+ *
+ * Marks rows of A that may have changed, including rows added or removed;
+ * rows of A outside every band must be unchanged.
+ */
+struct RowKeyRange {
+  RowKey first;
+  RowKey last;
+};
+
+namespace detail {
+
+/**
+ * @brief Sort bands by first key and merge the overlapping ones.
+ *
+ * @throws std::invalid_argument if a band has last < first
+ */
+inline std::vector<RowKeyRange> merge_row_ranges(std::vector<RowKeyRange> ranges) {
+  for (const RowKeyRange& r : ranges) {
+    if (r.last < r.first) {
+      throw std::invalid_argument("update_intersection: row range with last < first");
+    }
+  }
+  std::sort(ranges.begin(), ranges.end(),
+            [](const RowKeyRange& a, const RowKeyRange& b) { return a.first < b.first; });
+
+  std::vector<RowKeyRange> merged;
+  for (const RowKeyRange& r : ranges) {
+    if (!merged.empty() && !(merged.back().last < r.first)) {
+      if (merged.back().last < r.last) {
+        merged.back().last = r.last;
+      }
+    } else {
+      merged.push_back(r);
+    }
+  }
+  return merged;
+}
+
+} // namespace detail
+
+/**
+ * @brief Update prev = A_old ∩ B after the rows of A inside some bands changed.
+ *
+ * Only the rows of A inside the bands are intersected with B; the rows of
+ * prev outside the bands are spliced around them with a per-band shift of
+ * their row and interval offsets, so the intersection work is proportional
+ * to the change (the splice itself is a copy of prev).
+ *
+ * Algorithm:
+ * 1. Bounds - per band, row spans in A and prev (binary search)
+ * 2. Recompute - extract the rows of A in the bands and intersect with B
+ * 3. Splice - copy the kept rows of prev and the recomputed rows to their
+ *    shifted positions
+ *
+ * @param exec Execution space instance the operation is enqueued on
+ * @param prev Intersection of the previous A with B (B unchanged since)
+ * @param A Current first operand
+ * @param B Second operand
+ * @param changed Bands of rows of A that changed (any order, may overlap)
+ * @return A ∩ B
+ * @throws std::invalid_argument if a band has last < first
+ */
+template <class ExecSpace, class MemorySpace>
+Mesh3D<MemorySpace> update_intersection(const ExecSpace& exec,
+                                        const Mesh3D<MemorySpace>& prev,
+                                        const Mesh3D<MemorySpace>& A,
+                                        const Mesh3D<MemorySpace>& B,
+                                        const std::vector<RowKeyRange>& changed) {
+  using MeshType = Mesh3D<MemorySpace>;
+  using IndexView = typename MeshType::IndexView;
+
+  const profiling::ScopedRegion<ExecSpace> op_region(exec, "update_intersection");
+
+  const std::vector<RowKeyRange> bands = detail::merge_row_ranges(changed);
+  if (bands.empty()) {
+    return prev;
+  }
+  const std::size_t k = bands.size();
+
+  Kokkos::View<RowKeyRange*, MemorySpace> ranges(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "incremental_ranges"), k);
+  Kokkos::deep_copy(
+      exec, ranges,
+      Kokkos::View<const RowKeyRange*, Kokkos::HostSpace, Kokkos::MemoryTraits<Kokkos::Unmanaged>>(
+          bands.data(), k));
+
+  // Phase 1: Row spans of every band in A and prev
+  IndexView a_lo(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "incremental_a_lo"), k);
+  IndexView a_count(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "incremental_a_count"),
+                    k);
+  IndexView p_lo(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "incremental_p_lo"), k);
+  IndexView p_hi(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "incremental_p_hi"), k);
+  IndexView p_int_lo(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "incremental_p_int_lo"), k);
+  IndexView p_rows(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "incremental_p_rows"),
+                   k);
+  IndexView p_ints(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "incremental_p_ints"),
+                   k);
+
+  auto keys_a = A.row_keys;
+  auto keys_p = prev.row_keys;
+  auto ptr_p = prev.row_ptr;
+  const std::size_t n_a = A.num_rows;
+  const std::size_t n_p = prev.num_rows;
+  Kokkos::parallel_for(
+      "incremental_bounds",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, k),
+      KOKKOS_LAMBDA(const std::size_t j) {
+        const RowKeyRange r = ranges(j);
+        const std::size_t alo = subsetix::detail::lower_bound_row(keys_a, n_a, r.first);
+        a_lo(j) = alo;
+        a_count(j) = subsetix::detail::upper_bound_row(keys_a, n_a, r.last) - alo;
+
+        const std::size_t plo = subsetix::detail::lower_bound_row(keys_p, n_p, r.first);
+        const std::size_t phi = subsetix::detail::upper_bound_row(keys_p, n_p, r.last);
+        p_lo(j) = plo;
+        p_hi(j) = phi;
+        p_rows(j) = phi - plo;
+        p_int_lo(j) = (n_p == 0) ? 0 : ptr_p(plo);
+        p_ints(j) = (n_p == 0) ? 0 : ptr_p(phi) - ptr_p(plo);
+      });
+
+  // Phase 2: Intersect the rows of A inside the bands
+  IndexView a_offsets(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "incremental_a_offsets"), k + 1);
+  const std::size_t m = subsetix::detail::exclusive_scan_csr_row_ptr<std::size_t>(
+      exec, "incremental_a_scan", k, a_count, a_offsets);
+  IndexView rows(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "incremental_rows"), m);
+  Kokkos::parallel_for(
+      "incremental_rows",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, m),
+      KOKKOS_LAMBDA(const std::size_t t) {
+        const std::size_t j = subsetix::detail::find_segment(a_offsets, k, t);
+        rows(t) = a_lo(j) + (t - a_offsets(j));
+      });
+  const MeshType dirty = intersect_meshes(exec, extract_rows(exec, A, rows), B);
+
+  // Prefix sums of the rows and intervals of prev dropped before each band
+  IndexView p_row_prefix(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "incremental_p_row_prefix"), k + 1);
+  IndexView p_int_prefix(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "incremental_p_int_prefix"), k + 1);
+  const std::size_t dropped_rows = subsetix::detail::exclusive_scan_csr_row_ptr<std::size_t>(
+      exec, "incremental_p_row_scan", k, p_rows, p_row_prefix);
+  const std::size_t dropped_ints = subsetix::detail::exclusive_scan_csr_row_ptr<std::size_t>(
+      exec, "incremental_p_int_scan", k, p_ints, p_int_prefix);
+
+  // Row and interval offsets of every band in the recomputed rows
+  IndexView d_lo(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "incremental_d_lo"), k + 1);
+  IndexView d_int_lo(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "incremental_d_int_lo"), k + 1);
+  auto keys_d = dirty.row_keys;
+  auto ptr_d = dirty.row_ptr;
+  const std::size_t n_d = dirty.num_rows;
+  const std::size_t ni_d = dirty.num_intervals;
+  Kokkos::parallel_for(
+      "incremental_dirty_bounds",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, k + 1),
+      KOKKOS_LAMBDA(const std::size_t j) {
+        if (j == k) {
+          d_lo(j) = n_d;
+          d_int_lo(j) = ni_d;
+          return;
+        }
+        const std::size_t dlo = subsetix::detail::lower_bound_row(keys_d, n_d, ranges(j).first);
+        d_lo(j) = dlo;
+        d_int_lo(j) = (n_d == 0) ? 0 : ptr_d(dlo);
+      });
+
+  // Phase 3: Splice
+  const std::size_t num_rows_out = n_p - dropped_rows + n_d;
+  const std::size_t num_intervals_out = prev.num_intervals - dropped_ints + ni_d;
+  if (num_rows_out == 0) {
+    return MeshType{};
+  }
+
+  MeshType out;
+  out.num_rows = num_rows_out;
+  out.num_intervals = num_intervals_out;
+  out.row_keys = typename MeshType::RowKeyView(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "mesh_row_keys"), num_rows_out);
+  out.row_ptr = IndexView(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "mesh_row_ptr"),
+                          num_rows_out + 1);
+  out.intervals = typename MeshType::IntervalView(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "mesh_intervals"), num_intervals_out);
+
+  auto out_keys = out.row_keys;
+  auto out_ptr = out.row_ptr;
+  auto out_intervals = out.intervals;
+  auto intervals_p = prev.intervals;
+  auto intervals_d = dirty.intervals;
+
+  // Kept rows of prev: row i lies in the gap before band g
+  Kokkos::parallel_for(
+      "incremental_splice_prev",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, n_p),
+      KOKKOS_LAMBDA(const std::size_t i) {
+        std::size_t lo = 0;
+        std::size_t hi = k;
+        while (lo < hi) {
+          const std::size_t mid = lo + (hi - lo) / 2;
+          if (p_lo(mid) <= i) {
+            lo = mid + 1;
+          } else {
+            hi = mid;
+          }
+        }
+        const std::size_t g = lo;
+        if (g > 0 && i < p_hi(g - 1)) {
+          return;
+        }
+
+        const std::size_t dst = i - p_row_prefix(g) + d_lo(g);
+        const std::size_t begin = ptr_p(i);
+        const std::size_t count = ptr_p(i + 1) - begin;
+        const std::size_t offset = begin - p_int_prefix(g) + d_int_lo(g);
+        out_keys(dst) = keys_p(i);
+        out_ptr(dst) = offset;
+        for (std::size_t c = 0; c < count; ++c) {
+          out_intervals(offset + c) = intervals_p(begin + c);
+        }
+      });
+
+  // Recomputed rows: row t lies in band g
+  Kokkos::parallel_for(
+      "incremental_splice_dirty",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, n_d),
+      KOKKOS_LAMBDA(const std::size_t t) {
+        const std::size_t g = subsetix::detail::find_segment(d_lo, k, t);
+        const std::size_t dst = t + p_lo(g) - p_row_prefix(g);
+        const std::size_t begin = ptr_d(t);
+        const std::size_t count = ptr_d(t + 1) - begin;
+        const std::size_t offset = begin + p_int_lo(g) - p_int_prefix(g);
+        out_keys(dst) = keys_d(t);
+        out_ptr(dst) = offset;
+        for (std::size_t c = 0; c < count; ++c) {
+          out_intervals(offset + c) = intervals_d(begin + c);
+        }
+      });
+
+  Kokkos::deep_copy(exec, Kokkos::subview(out_ptr, num_rows_out), num_intervals_out);
+
+  // The host band list must outlive the asynchronous upload
+  exec.fence("incremental_splice");
+  return out;
+}
+
+/**
+ * @brief Incremental intersection update on the default instance of the mesh space.
+ */
+template <class MemorySpace>
+Mesh3D<MemorySpace> update_intersection(const Mesh3D<MemorySpace>& prev,
+                                        const Mesh3D<MemorySpace>& A,
+                                        const Mesh3D<MemorySpace>& B,
+                                        const std::vector<RowKeyRange>& changed) {
+  return update_intersection(typename MemorySpace::execution_space(), prev, A, B, changed);
+}
+
+} // namespace subsetix::intersection::v1
@@ -4,31 +4,65 @@
 #pragma once
 
 #include <subsetix/mesh.hpp>
+#include <subsetix/profiling.hpp>
 #include <subsetix/detail/utils.hpp>
 
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
 namespace subsetix::intersection::v1 {
 
 namespace detail {
 
+/**
+ * @brief Accumulator policies of row_intersection_impl.
+ *
+ * measure(start, end) is summed over the non-empty pieces [start, end) of the
+ * merge; pieces are also stored in the output view when writes is true.
+ */
+struct CountIntervals {
+  using value_type = std::size_t;
+  static constexpr bool writes = false;
+
+  KOKKOS_INLINE_FUNCTION
+  static value_type measure(Coord, Coord) { return 1; }
+};
+
+struct WriteIntervals : CountIntervals {
+  static constexpr bool writes = true;
+};
+
+struct CountCells {
+  using value_type = std::int64_t;
+  static constexpr bool writes = false;
+
+  KOKKOS_INLINE_FUNCTION
+  static value_type measure(Coord start, Coord end) {
+    return static_cast<std::int64_t>(end) - start;
+  }
+};
+
 /**
  * @brief Core row intersection algorithm (two-pointer merge).
  *
- * When CountOnly=true, only counts intervals without writing.
- * When CountOnly=false, writes intervals to intervals_out.
+ * Accumulator selects what is returned (number of intervals or of cells)
+ * and whether intervals are written to intervals_out from out_offset.
  */
-template <bool CountOnly, class IntervalViewIn, class IntervalViewOut>
+template <class Accumulator, class IntervalViewIn, class IntervalViewOut>
 KOKKOS_INLINE_FUNCTION
-std::size_t row_intersection_impl(const IntervalViewIn& intervals_a,
-                                  std::size_t begin_a,
-                                  std::size_t end_a,
-                                  const IntervalViewIn& intervals_b,
-                                  std::size_t begin_b,
-                                  std::size_t end_b,
-                                  const IntervalViewOut& intervals_out,
-                                  std::size_t out_offset) {
+typename Accumulator::value_type row_intersection_impl(const IntervalViewIn& intervals_a,
+                                                       std::size_t begin_a,
+                                                       std::size_t end_a,
+                                                       const IntervalViewIn& intervals_b,
+                                                       std::size_t begin_b,
+                                                       std::size_t end_b,
+                                                       const IntervalViewOut& intervals_out,
+                                                       std::size_t out_offset) {
   std::size_t ia = begin_a;
   std::size_t ib = begin_b;
   std::size_t count = 0;
+  typename Accumulator::value_type total = 0;
 
   while (ia < end_a && ib < end_b) {
     const auto a = intervals_a(ia);
@@ -40,10 +74,11 @@ std::size_t row_intersection_impl(const IntervalViewIn& intervals_a,
 
     // Add non-empty intersection
     if (start < end) {
-      if constexpr (!CountOnly) {
+      if constexpr (Accumulator::writes) {
         intervals_out(out_offset + count) = Interval{start, end};
+        ++count;
       }
-      ++count;
+      total += Accumulator::measure(start, end);
     }
 
     // Advance the interval that ends first
@@ -57,51 +92,94 @@ std::size_t row_intersection_impl(const IntervalViewIn& intervals_a,
     }
   }
 
-  return count;
+  return total;
 }
 
-} // namespace detail
+/**
+ * @brief Row intersection for accumulators that do not write intervals.
+ */
+template <class Accumulator, class IntervalViewIn>
+KOKKOS_INLINE_FUNCTION
+typename Accumulator::value_type row_intersection_impl(const IntervalViewIn& intervals_a,
+                                                       std::size_t begin_a,
+                                                       std::size_t end_a,
+                                                       const IntervalViewIn& intervals_b,
+                                                       std::size_t begin_b,
+                                                       std::size_t end_b) {
+  static_assert(!Accumulator::writes, "row_intersection_impl: no output view given");
+  return row_intersection_impl<Accumulator>(intervals_a, begin_a, end_a, intervals_b, begin_b,
+                                            end_b, intervals_a, 0);
+}
 
 /**
- * @brief Compute the intersection of two meshes.
- *
- * Returns a new mesh containing only the cells that exist in BOTH input meshes.
- *
- * Algorithm:
- * 1. Row mapping - find common (Y,Z) rows via binary search
- * 2. Count - count intersecting X-intervals per row
- * 3. Scan - compute CSR offsets
- * 4. Fill - write intersected intervals
- * 5. Compact - filter rows with no intersections
- *
- * @param A First input mesh
- * @param B Second input mesh
- * @return Intersection mesh
+ * @brief Row lookup in a mesh whose rows are stored in canonical (y, z) order.
  */
-inline Mesh3DDevice intersect_meshes(const Mesh3DDevice& A,
-                                     const Mesh3DDevice& B) {
-  if (A.num_rows == 0 || B.num_rows == 0) {
-    return Mesh3DDevice{};
+template <class RowKeyView>
+struct SortedRowFinder {
+  RowKeyView rows;
+  std::size_t num_rows = 0;
+
+  KOKKOS_INLINE_FUNCTION
+  int operator()(Coord y, Coord z) const {
+    return subsetix::detail::find_row_by_yz(rows, num_rows, y, z);
   }
+};
 
-  // Allocate temporary buffers
-  const std::size_t num_rows_a = A.num_rows;
-  Kokkos::View<int*, Kokkos::DefaultExecutionSpace::memory_space> flags("flags", num_rows_a);
-  Kokkos::View<int*, Kokkos::DefaultExecutionSpace::memory_space> tmp_idx_a("tmp_idx_a", num_rows_a);
-  Kokkos::View<int*, Kokkos::DefaultExecutionSpace::memory_space> tmp_idx_b("tmp_idx_b", num_rows_a);
-  Kokkos::View<std::size_t*, Kokkos::DefaultExecutionSpace::memory_space> positions("positions", num_rows_a);
+/**
+ * @brief Temporaries shared by the phases of an intersection.
+ *
+ * Each phase fills its own members and reads those of earlier phases, so a
+ * phase can also be replayed alone on a workspace produced by a full run
+ * (see benchmarks/intersection_benchmark.cpp).
+ */
+template <class MemorySpace>
+struct IntersectionWorkspace {
+  using IntView = Kokkos::View<int*, MemorySpace>;
+  using SizeView = Kokkos::View<std::size_t*, MemorySpace>;
+
+  IntView flags;
+  IntView tmp_idx_a;
+  IntView tmp_idx_b;
+  SizeView positions;
+  std::size_t num_rows_out = 0;
+
+  IntView out_idx_a;
+  IntView out_idx_b;
+  SizeView row_counts;
+  Mesh3D<MemorySpace> out;
+
+  IntView has_intervals;
+  SizeView new_positions;
+  std::size_t final_num_rows = 0;
+};
 
+/**
+ * @brief Phase row_map: find the rows of A that exist in B.
+ */
+template <class ExecSpace, class MemorySpace, class RowFinder>
+void intersection_row_map(const ExecSpace& exec,
+                          IntersectionWorkspace<MemorySpace>& ws,
+                          const Mesh3D<MemorySpace>& A,
+                          const RowFinder& find_row_b) {
+  const profiling::ScopedRegion<ExecSpace> region(exec, "row_map");
+  const std::size_t num_rows_a = A.num_rows;
   auto rows_a = A.row_keys;
-  auto rows_b = B.row_keys;
-  const std::size_t num_rows_b = B.num_rows;
 
-  // Phase 1: Row mapping - find rows of A that exist in B
+  ws.flags = Kokkos::View<int*, MemorySpace>(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "flags"), num_rows_a);
+  ws.tmp_idx_a = Kokkos::View<int*, MemorySpace>(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "tmp_idx_a"), num_rows_a);
+  ws.tmp_idx_b = Kokkos::View<int*, MemorySpace>(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "tmp_idx_b"), num_rows_a);
+  auto flags = ws.flags;
+  auto tmp_idx_a = ws.tmp_idx_a;
+  auto tmp_idx_b = ws.tmp_idx_b;
   Kokkos::parallel_for(
       "intersection_row_map",
-      Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, num_rows_a),
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, num_rows_a),
       KOKKOS_LAMBDA(const std::size_t i) {
         const RowKey key = rows_a(i);
-        const int idx_b = subsetix::detail::find_row_by_yz(rows_b, num_rows_b, key.y, key.z);
+        const int idx_b = find_row_b(key.y, key.z);
         if (idx_b >= 0) {
           flags(i) = 1;
           tmp_idx_a(i) = static_cast<int>(i);
@@ -112,14 +190,25 @@ inline Mesh3DDevice intersect_meshes(const Mesh3DDevice& A,
           tmp_idx_b(i) = -1;
         }
       });
+}
 
-  Kokkos::fence();
-
-  // Scan to count matching rows and compute positions
-  Kokkos::View<std::size_t, Kokkos::DefaultExecutionSpace::memory_space> num_rows_out_view("num_rows_out");
+/**
+ * @brief Phase row_scan: positions of the matching rows and their number.
+ */
+template <class ExecSpace, class MemorySpace>
+void intersection_row_scan(const ExecSpace& exec, IntersectionWorkspace<MemorySpace>& ws) {
+  const profiling::ScopedRegion<ExecSpace> region(exec, "row_scan");
+  const std::size_t num_rows_a = ws.flags.extent(0);
+
+  ws.positions = Kokkos::View<std::size_t*, MemorySpace>(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "positions"), num_rows_a);
+  auto flags = ws.flags;
+  auto positions = ws.positions;
+  Kokkos::View<std::size_t, MemorySpace> num_rows_out_view(
+      Kokkos::view_alloc(exec, "num_rows_out"));
   Kokkos::parallel_scan(
       "intersection_row_scan",
-      Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, num_rows_a),
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, num_rows_a),
       KOKKOS_LAMBDA(const std::size_t i, std::size_t& update, const bool final_pass) {
         const std::size_t count = static_cast<std::size_t>(flags(i));
         if (final_pass) {
@@ -131,25 +220,41 @@ inline Mesh3DDevice intersect_meshes(const Mesh3DDevice& A,
         update += count;
       });
 
-  Kokkos::fence();
-
-  std::size_t num_rows_out_host = 0;
-  Kokkos::deep_copy(num_rows_out_host, num_rows_out_view);
-  const std::size_t num_rows_out = num_rows_out_host;
+  Kokkos::deep_copy(exec, ws.num_rows_out, num_rows_out_view);
+  exec.fence("intersection_row_scan");
+}
 
-  if (num_rows_out == 0) {
-    return Mesh3DDevice{};
-  }
+/**
+ * @brief Phase row_compact: compact the matching rows and allocate the
+ *        output mesh (|A| + |B| intervals, the per-row bound summed).
+ */
+template <class ExecSpace, class MemorySpace>
+void intersection_row_compact(const ExecSpace& exec,
+                              IntersectionWorkspace<MemorySpace>& ws,
+                              const Mesh3D<MemorySpace>& A,
+                              const Mesh3D<MemorySpace>& B) {
+  using MeshType = Mesh3D<MemorySpace>;
+  const profiling::ScopedRegion<ExecSpace> region(exec, "row_compact");
+  const std::size_t num_rows_a = A.num_rows;
+  const std::size_t num_rows_out = ws.num_rows_out;
+  auto rows_a = A.row_keys;
 
-  // Allocate output buffers for row mapping
-  Kokkos::View<RowKey*, Kokkos::DefaultExecutionSpace::memory_space> out_rows("out_rows", num_rows_out);
-  Kokkos::View<int*, Kokkos::DefaultExecutionSpace::memory_space> out_idx_a("out_idx_a", num_rows_out);
-  Kokkos::View<int*, Kokkos::DefaultExecutionSpace::memory_space> out_idx_b("out_idx_b", num_rows_out);
+  Kokkos::View<RowKey*, MemorySpace> out_rows(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "out_rows"), num_rows_out);
+  ws.out_idx_a = Kokkos::View<int*, MemorySpace>(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "out_idx_a"), num_rows_out);
+  ws.out_idx_b = Kokkos::View<int*, MemorySpace>(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "out_idx_b"), num_rows_out);
+  auto flags = ws.flags;
+  auto positions = ws.positions;
+  auto tmp_idx_a = ws.tmp_idx_a;
+  auto tmp_idx_b = ws.tmp_idx_b;
+  auto out_idx_a = ws.out_idx_a;
+  auto out_idx_b = ws.out_idx_b;
 
-  // Compact matching rows
   Kokkos::parallel_for(
       "intersection_row_compact",
-      Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, num_rows_a),
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, num_rows_a),
       KOKKOS_LAMBDA(const std::size_t i) {
         if (!flags(i)) {
           return;
@@ -160,32 +265,44 @@ inline Mesh3DDevice intersect_meshes(const Mesh3DDevice& A,
         out_idx_b(pos) = tmp_idx_b(i);
       });
 
-  Kokkos::fence();
-
   // Allocate output mesh
-  Mesh3DDevice out;
-  if (num_rows_out > 0) {
-    out.row_keys = typename Mesh3DDevice::RowKeyView("mesh_row_keys", num_rows_out);
-    out.row_ptr = typename Mesh3DDevice::IndexView("mesh_row_ptr", num_rows_out + 1);
-    out.intervals = typename Mesh3DDevice::IntervalView(
-        "mesh_intervals", A.num_intervals + B.num_intervals);
-  }
+  MeshType& out = ws.out;
+  out = MeshType{};
+  out.row_keys = typename MeshType::RowKeyView(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "mesh_row_keys"), num_rows_out);
+  out.row_ptr = typename MeshType::IndexView(
+      Kokkos::view_alloc(exec, "mesh_row_ptr"), num_rows_out + 1);
+  out.intervals = typename MeshType::IntervalView(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "mesh_intervals"),
+      A.num_intervals + B.num_intervals);
 
   // Copy row keys
-  Kokkos::deep_copy(out.row_keys, out_rows);
-
-  // Allocate row counts buffer
-  Kokkos::View<std::size_t*, Kokkos::DefaultExecutionSpace::memory_space> row_counts("row_counts", num_rows_out);
+  Kokkos::deep_copy(exec, out.row_keys, out_rows);
+}
 
+/**
+ * @brief Phase count: number of intersected intervals per output row.
+ */
+template <class ExecSpace, class MemorySpace>
+void intersection_count(const ExecSpace& exec,
+                        IntersectionWorkspace<MemorySpace>& ws,
+                        const Mesh3D<MemorySpace>& A,
+                        const Mesh3D<MemorySpace>& B) {
+  const profiling::ScopedRegion<ExecSpace> region(exec, "count");
+  const std::size_t num_rows_out = ws.num_rows_out;
   auto row_ptr_a = A.row_ptr;
   auto row_ptr_b = B.row_ptr;
   auto intervals_a = A.intervals;
   auto intervals_b = B.intervals;
+  auto out_idx_a = ws.out_idx_a;
+  auto out_idx_b = ws.out_idx_b;
 
-  // Phase 2: Count intervals per row
+  ws.row_counts = Kokkos::View<std::size_t*, MemorySpace>(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "row_counts"), num_rows_out);
+  auto row_counts = ws.row_counts;
   Kokkos::parallel_for(
       "intersection_count",
-      Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, num_rows_out),
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, num_rows_out),
       KOKKOS_LAMBDA(const std::size_t i) {
         const int ia = out_idx_a(i);
         const int ib = out_idx_b(i);
@@ -202,23 +319,32 @@ inline Mesh3DDevice intersect_meshes(const Mesh3DDevice& A,
           return;
         }
 
-        row_counts(i) = detail::row_intersection_impl<true>(
+        row_counts(i) = detail::row_intersection_impl<detail::CountIntervals>(
             intervals_a, r.begin_a, r.end_a,
-            intervals_b, r.begin_b, r.end_b,
-            Kokkos::View<Interval*, Kokkos::DefaultExecutionSpace::memory_space>(), 0);
+            intervals_b, r.begin_b, r.end_b);
       });
+}
 
-  // Phase 3: Scan to compute row_ptr offsets
-  Kokkos::View<std::size_t, Kokkos::DefaultExecutionSpace::memory_space> total_view("total_intervals");
+/**
+ * @brief Phase scan: CSR offsets of the output rows and their total.
+ */
+template <class ExecSpace, class MemorySpace>
+void intersection_scan(const ExecSpace& exec, IntersectionWorkspace<MemorySpace>& ws) {
+  const profiling::ScopedRegion<ExecSpace> region(exec, "scan");
+  const std::size_t num_rows_out = ws.num_rows_out;
+  auto row_counts = ws.row_counts;
+  auto row_ptr = ws.out.row_ptr;
+
+  Kokkos::View<std::size_t, MemorySpace> total_view(Kokkos::view_alloc(exec, "total_intervals"));
   Kokkos::parallel_scan(
       "intersection_scan",
-      Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, num_rows_out),
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, num_rows_out),
       KOKKOS_LAMBDA(const std::size_t i, std::size_t& update, const bool final_pass) {
         const std::size_t count = row_counts(i);
         if (final_pass) {
-          out.row_ptr(i) = update;
+          row_ptr(i) = update;
           if (i + 1 == num_rows_out) {
-            out.row_ptr(num_rows_out) = update + count;
+            row_ptr(num_rows_out) = update + count;
             total_view() = update + count;
           }
         }
@@ -226,18 +352,33 @@ inline Mesh3DDevice intersect_meshes(const Mesh3DDevice& A,
       });
 
   std::size_t num_intervals_host = 0;
-  Kokkos::deep_copy(num_intervals_host, total_view);
-  out.num_intervals = num_intervals_host;
-  out.num_rows = num_rows_out;
+  Kokkos::deep_copy(exec, num_intervals_host, total_view);
+  exec.fence("intersection_scan");
+  ws.out.num_intervals = num_intervals_host;
+  ws.out.num_rows = num_rows_out;
+}
 
-  if (out.num_intervals == 0) {
-    return Mesh3DDevice{};
-  }
+/**
+ * @brief Phase fill: write the intersected intervals.
+ */
+template <class ExecSpace, class MemorySpace>
+void intersection_fill(const ExecSpace& exec,
+                       const IntersectionWorkspace<MemorySpace>& ws,
+                       const Mesh3D<MemorySpace>& A,
+                       const Mesh3D<MemorySpace>& B) {
+  const profiling::ScopedRegion<ExecSpace> region(exec, "fill");
+  auto row_ptr_a = A.row_ptr;
+  auto row_ptr_b = B.row_ptr;
+  auto intervals_a = A.intervals;
+  auto intervals_b = B.intervals;
+  auto out_idx_a = ws.out_idx_a;
+  auto out_idx_b = ws.out_idx_b;
+  auto out_row_ptr = ws.out.row_ptr;
+  auto out_intervals = ws.out.intervals;
 
-  // Phase 4: Fill intersected intervals
   Kokkos::parallel_for(
       "intersection_fill",
-      Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, num_rows_out),
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, ws.num_rows_out),
       KOKKOS_LAMBDA(const std::size_t i) {
         const int ia = out_idx_a(i);
         const int ib = out_idx_b(i);
@@ -252,26 +393,40 @@ inline Mesh3DDevice intersect_meshes(const Mesh3DDevice& A,
           return;
         }
 
-        detail::row_intersection_impl<false>(
+        detail::row_intersection_impl<detail::WriteIntervals>(
             intervals_a, r.begin_a, r.end_a,
             intervals_b, r.begin_b, r.end_b,
-            out.intervals, out.row_ptr(i));
+            out_intervals, out_row_ptr(i));
       });
+}
 
-  // Phase 5: Compact - remove rows with no intervals
-  Kokkos::View<int*, Kokkos::DefaultExecutionSpace::memory_space> has_intervals("has_intervals", num_rows_out);
+/**
+ * @brief Phase mark: flag the non-empty output rows and number them.
+ */
+template <class ExecSpace, class MemorySpace>
+void intersection_mark(const ExecSpace& exec, IntersectionWorkspace<MemorySpace>& ws) {
+  const profiling::ScopedRegion<ExecSpace> region(exec, "mark");
+  const std::size_t num_rows_out = ws.num_rows_out;
+  auto out_row_ptr = ws.out.row_ptr;
+
+  ws.has_intervals = Kokkos::View<int*, MemorySpace>(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "has_intervals"), num_rows_out);
+  auto has_intervals = ws.has_intervals;
   Kokkos::parallel_for(
       "intersection_mark_rows",
-      Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, num_rows_out),
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, num_rows_out),
       KOKKOS_LAMBDA(const std::size_t i) {
-        has_intervals(i) = (out.row_ptr(i) < out.row_ptr(i + 1)) ? 1 : 0;
+        has_intervals(i) = (out_row_ptr(i) < out_row_ptr(i + 1)) ? 1 : 0;
       });
 
-  Kokkos::View<std::size_t*, Kokkos::DefaultExecutionSpace::memory_space> new_positions("new_positions", num_rows_out);
-  Kokkos::View<std::size_t, Kokkos::DefaultExecutionSpace::memory_space> final_num_rows_view("final_num_rows");
+  ws.new_positions = Kokkos::View<std::size_t*, MemorySpace>(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "new_positions"), num_rows_out);
+  auto new_positions = ws.new_positions;
+  Kokkos::View<std::size_t, MemorySpace> final_num_rows_view(
+      Kokkos::view_alloc(exec, "final_num_rows"));
   Kokkos::parallel_scan(
       "intersection_compact_scan",
-      Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, num_rows_out),
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, num_rows_out),
       KOKKOS_LAMBDA(const std::size_t i, std::size_t& update, const bool final_pass) {
         const std::size_t count = static_cast<std::size_t>(has_intervals(i));
         if (final_pass) {
@@ -283,29 +438,42 @@ inline Mesh3DDevice intersect_meshes(const Mesh3DDevice& A,
         update += count;
       });
 
-  std::size_t final_num_rows = 0;
-  Kokkos::deep_copy(final_num_rows, final_num_rows_view);
-
-  if (final_num_rows == num_rows_out) {
-    return out;  // No compaction needed
-  }
+  Kokkos::deep_copy(exec, ws.final_num_rows, final_num_rows_view);
+  exec.fence("intersection_compact_scan");
+}
 
-  if (final_num_rows == 0) {
-    return Mesh3DDevice{};
-  }
+/**
+ * @brief Phase compact_copy: copy the non-empty rows into a new mesh.
+ */
+template <class ExecSpace, class MemorySpace>
+Mesh3D<MemorySpace> intersection_compact_copy(const ExecSpace& exec,
+                                              const IntersectionWorkspace<MemorySpace>& ws) {
+  using MeshType = Mesh3D<MemorySpace>;
+  const profiling::ScopedRegion<ExecSpace> region(exec, "compact_copy");
+  const MeshType out = ws.out;
+  const std::size_t num_rows_out = ws.num_rows_out;
+  const std::size_t final_num_rows = ws.final_num_rows;
+  auto has_intervals = ws.has_intervals;
+  auto new_positions = ws.new_positions;
 
   // Allocate compacted output
-  Mesh3DDevice compacted;
-  compacted.row_keys = typename Mesh3DDevice::RowKeyView("compacted_row_keys", final_num_rows);
-  compacted.row_ptr = typename Mesh3DDevice::IndexView("compacted_row_ptr", final_num_rows + 1);
-  compacted.intervals = typename Mesh3DDevice::IntervalView("compacted_intervals", out.num_intervals);
+  MeshType compacted;
+  compacted.row_keys = typename MeshType::RowKeyView(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "compacted_row_keys"),
+      final_num_rows);
+  compacted.row_ptr = typename MeshType::IndexView(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "compacted_row_ptr"),
+      final_num_rows + 1);
+  compacted.intervals = typename MeshType::IntervalView(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "compacted_intervals"),
+      out.num_intervals);
   compacted.num_rows = final_num_rows;
   compacted.num_intervals = out.num_intervals;
 
   // Copy non-empty rows: one thread per SOURCE row (O(n) instead of O(n²))
   Kokkos::parallel_for(
       "intersection_compact_copy",
-      Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, num_rows_out),
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, num_rows_out),
       KOKKOS_LAMBDA(const std::size_t j) {
         if (has_intervals(j)) {
           const std::size_t new_pos = new_positions(j);
@@ -317,7 +485,7 @@ inline Mesh3DDevice intersect_meshes(const Mesh3DDevice& A,
   // Set final row_ptr value
   Kokkos::parallel_for(
       "intersection_compact_final_ptr",
-      Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, 1),
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, 1),
       KOKKOS_LAMBDA(const std::size_t) {
         compacted.row_ptr(final_num_rows) = out.row_ptr(num_rows_out);
       });
@@ -325,7 +493,7 @@ inline Mesh3DDevice intersect_meshes(const Mesh3DDevice& A,
   // Copy intervals
   Kokkos::parallel_for(
       "intersection_compact_intervals",
-      Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, out.num_intervals),
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, out.num_intervals),
       KOKKOS_LAMBDA(const std::size_t i) {
         compacted.intervals(i) = out.intervals(i);
       });
@@ -333,6 +501,447 @@ inline Mesh3DDevice intersect_meshes(const Mesh3DDevice& A,
   return compacted;
 }
 
+/**
+ * @brief Intersection kernels, parameterised on how rows of B are located.
+ *
+ * Output rows follow the storage order of A. find_row_b(y, z) must return
+ * the storage index of row (y, z) in B, or -1 if B has no such row.
+ *
+ * All kernels, allocations and copies are enqueued on exec; the only
+ * synchronisations are instance fences before the host reads a size.
+ * Temporaries and the result live in the memory space of the inputs.
+ *
+ * The whole operation is the profiling region "intersect_meshes" and each
+ * phase function above a nested region (row_map, row_scan, row_compact,
+ * count, scan, fill, mark, compact_copy); see subsetix/profiling.hpp.
+ *
+ * When the result is non-empty, ws keeps the temporaries of the run: result
+ * row new_positions(j) comes from row out_idx_a(j) of A for every j with
+ * has_intervals(j) set.
+ */
+template <class ExecSpace, class MemorySpace, class RowFinder>
+Mesh3D<MemorySpace> intersect_with_row_finder(const ExecSpace& exec,
+                                              IntersectionWorkspace<MemorySpace>& ws,
+                                              const Mesh3D<MemorySpace>& A,
+                                              const Mesh3D<MemorySpace>& B,
+                                              const RowFinder& find_row_b) {
+  using MeshType = Mesh3D<MemorySpace>;
+  static_assert(Kokkos::SpaceAccessibility<ExecSpace, MemorySpace>::accessible,
+                "intersect_meshes: execution space cannot access the mesh memory space");
+
+  const profiling::ScopedRegion<ExecSpace> op_region(exec, "intersect_meshes");
+
+  if (A.num_rows == 0 || B.num_rows == 0) {
+    return MeshType{};
+  }
+
+  // Phase 1: Row mapping - find rows of A that exist in B
+  intersection_row_map(exec, ws, A, find_row_b);
+  intersection_row_scan(exec, ws);
+  if (ws.num_rows_out == 0) {
+    return MeshType{};
+  }
+  intersection_row_compact(exec, ws, A, B);
+
+  // Phase 2: Count intervals per row
+  intersection_count(exec, ws, A, B);
+
+  // Phase 3: Scan to compute row_ptr offsets
+  intersection_scan(exec, ws);
+  if (ws.out.num_intervals == 0) {
+    return MeshType{};
+  }
+
+  // Phase 4: Fill intersected intervals
+  intersection_fill(exec, ws, A, B);
+
+  // Phase 5: Compact - remove rows with no intervals
+  intersection_mark(exec, ws);
+  if (ws.final_num_rows == ws.num_rows_out) {
+    return ws.out;  // No compaction needed
+  }
+  if (ws.final_num_rows == 0) {
+    return MeshType{};
+  }
+  return intersection_compact_copy(exec, ws);
+}
+
+template <class ExecSpace, class MemorySpace, class RowFinder>
+Mesh3D<MemorySpace> intersect_with_row_finder(const ExecSpace& exec,
+                                              const Mesh3D<MemorySpace>& A,
+                                              const Mesh3D<MemorySpace>& B,
+                                              const RowFinder& find_row_b) {
+  IntersectionWorkspace<MemorySpace> ws;
+  return intersect_with_row_finder(exec, ws, A, B, find_row_b);
+}
+
+} // namespace detail
+
+/**
+ * @brief Compute the intersection of two meshes.
+ *
+ * Returns a new mesh containing only the cells that exist in BOTH input meshes.
+ *
+ * Algorithm:
+ * 1. Row mapping - find common (Y,Z) rows via binary search
+ * 2. Count - count intersecting X-intervals per row
+ * 3. Scan - compute CSR offsets
+ * 4. Fill - write intersected intervals
+ * 5. Compact - filter rows with no intersections
+ *
+ * Every kernel runs on exec and only exec is fenced, so intersections
+ * issued on disjoint instances (e.g. from Kokkos::Experimental::partition_space)
+ * can run concurrently. Sizes are read back after instance fences; the
+ * returned mesh may still be written by exec, so fence exec (or keep using
+ * it) before reading the result from another instance.
+ *
+ * The operation runs in the memory space of the inputs: host meshes are
+ * intersected in place on a host execution space, with no round trip
+ * through the device.
+ *
+ * @param exec Execution space instance the operation is enqueued on; must
+ *        be able to access MemorySpace
+ * @param A First input mesh
+ * @param B Second input mesh
+ * @return Intersection mesh
+ */
+template <class ExecSpace, class MemorySpace>
+Mesh3D<MemorySpace> intersect_meshes(const ExecSpace& exec,
+                                     const Mesh3D<MemorySpace>& A,
+                                     const Mesh3D<MemorySpace>& B) {
+  using RowKeyView = typename Mesh3D<MemorySpace>::RowKeyView;
+  return detail::intersect_with_row_finder(
+      exec, A, B, detail::SortedRowFinder<RowKeyView>{B.row_keys, B.num_rows});
+}
+
+/**
+ * @brief Compute the intersection of two meshes where their data lives.
+ *
+ * Runs on the default instance of the execution space of MemorySpace:
+ * Mesh3DDevice on Kokkos::DefaultExecutionSpace, Mesh3DHost on
+ * Kokkos::DefaultHostExecutionSpace. No copy between spaces is made.
+ */
+template <class MemorySpace>
+Mesh3D<MemorySpace> intersect_meshes(const Mesh3D<MemorySpace>& A,
+                                     const Mesh3D<MemorySpace>& B) {
+  return intersect_meshes(typename MemorySpace::execution_space(), A, B);
+}
+
+// ============================================================================
+// In-place intersection
+// ============================================================================
+
+namespace detail {
+
+// Row blocks intersect_inplace walks through; the scratch holds about one
+// block of the result
+inline constexpr std::size_t inplace_num_blocks = 8;
+
+} // namespace detail
+
+/**
+ * @brief Replace A by A ∩ B, reusing the buffers of A.
+ *
+ * Counts and output offsets are computed first, then A is compacted left
+ * to right in detail::inplace_num_blocks row blocks of about equal output
+ * size. Once a block has been read, the input storage of all rows before
+ * it is free:
+ * - a row whose output lands entirely in that free prefix is written
+ *   straight into A.intervals;
+ * - the other rows of the block go to a scratch buffer, copied back as soon
+ *   as their destination no longer overlaps input still to be read.
+ * When the result never runs ahead of the input (masking passes), the
+ * scratch holds one block, so the peak is A + B + per-row metadata + about
+ * 1/8 of the result, instead of the |A| + |B| output allocation and
+ * compacted copy of intersect_meshes. Row keys and offsets are compacted
+ * into A.row_keys and A.row_ptr, trimmed to the surviving rows.
+ *
+ * A row may gain intervals (up to |a| + |b| - 1 per row); when the result
+ * outgrows A.intervals, it is filled into a new buffer of the result size
+ * instead. B may alias A.
+ *
+ * @param exec Execution space instance the operation is enqueued on; must
+ *        be able to access MemorySpace
+ * @param A Mesh overwritten by the intersection
+ * @param B Second input mesh
+ */
+template <class ExecSpace, class MemorySpace>
+void intersect_inplace(const ExecSpace& exec,
+                       Mesh3D<MemorySpace>& A,
+                       const Mesh3D<MemorySpace>& B) {
+  using MeshType = Mesh3D<MemorySpace>;
+  using IndexView = typename MeshType::IndexView;
+  using Region = profiling::ScopedRegion<ExecSpace>;
+  static_assert(Kokkos::SpaceAccessibility<ExecSpace, MemorySpace>::accessible,
+                "intersect_inplace: execution space cannot access the mesh memory space");
+
+  const Region op_region(exec, "intersect_inplace");
+
+  if (A.num_rows == 0) {
+    return;
+  }
+  if (B.num_rows == 0) {
+    A = MeshType{};
+    return;
+  }
+
+  const std::size_t n = A.num_rows;
+  auto rows_a = A.row_keys;
+  auto ptr_a = A.row_ptr;
+  auto intervals_a = A.intervals;
+  auto ptr_b = B.row_ptr;
+  auto intervals_b = B.intervals;
+  const detail::SortedRowFinder<typename MeshType::RowKeyView> find_row_b{B.row_keys,
+                                                                          B.num_rows};
+
+  // Phase 1: Row lookup and interval counts
+  Kokkos::View<int*, MemorySpace> idx_b;
+  IndexView counts;
+  {
+    const Region region(exec, "count");
+    idx_b = Kokkos::View<int*, MemorySpace>(
+        Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "inplace_idx_b"), n);
+    counts = IndexView(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "inplace_counts"),
+                       n);
+    Kokkos::parallel_for(
+        "intersection_inplace_count",
+        Kokkos::RangePolicy<ExecSpace>(exec, 0, n),
+        KOKKOS_LAMBDA(const std::size_t i) {
+          const RowKey key = rows_a(i);
+          const int ib = find_row_b(key.y, key.z);
+          idx_b(i) = ib;
+          counts(i) = (ib < 0) ? 0
+                               : detail::row_intersection_impl<detail::CountIntervals>(
+                                     intervals_a, ptr_a(i), ptr_a(i + 1),
+                                     intervals_b, ptr_b(ib), ptr_b(ib + 1));
+        });
+  }
+
+  // Phase 2: Output offsets over all rows of A
+  IndexView offsets;
+  std::size_t total = 0;
+  {
+    const Region region(exec, "scan");
+    offsets = IndexView(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "inplace_offsets"),
+                        n + 1);
+    total = subsetix::detail::exclusive_scan_csr_row_ptr<std::size_t>(
+        exec, "intersection_inplace_offsets", n, counts, offsets);
+  }
+  if (total == 0) {
+    A = MeshType{};
+    return;
+  }
+
+  // Phase 3: Fill
+  if (total > intervals_a.extent(0)) {
+    // The result outgrows A.intervals: nothing to reuse, fill a new buffer
+    const Region region(exec, "fill");
+    typename MeshType::IntervalView result(
+        Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "mesh_intervals"), total);
+    Kokkos::parallel_for(
+        "intersection_inplace_fill",
+        Kokkos::RangePolicy<ExecSpace>(exec, 0, n),
+        KOKKOS_LAMBDA(const std::size_t i) {
+          if (counts(i) == 0) {
+            return;
+          }
+          const int ib = idx_b(i);
+          detail::row_intersection_impl<detail::WriteIntervals>(
+              intervals_a, ptr_a(i), ptr_a(i + 1),
+              intervals_b, ptr_b(ib), ptr_b(ib + 1),
+              result, offsets(i));
+        });
+    A.intervals = result;
+  } else {
+    const std::size_t num_blocks =
+        (n < detail::inplace_num_blocks) ? n : detail::inplace_num_blocks;
+
+    // Block boundaries, balanced on output intervals
+    IndexView staged;  // scratch offsets of the rows that cannot be written directly
+    std::vector<std::size_t> bounds;  // per boundary: row, output, input, scratch offset
+    {
+      const Region region(exec, "plan");
+      IndexView block_row(
+          Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "inplace_block_row"),
+          num_blocks + 1);
+      Kokkos::parallel_for(
+          "intersection_inplace_blocks",
+          Kokkos::RangePolicy<ExecSpace>(exec, 0, num_blocks + 1),
+          KOKKOS_LAMBDA(const std::size_t b) {
+            if (b == num_blocks) {
+              block_row(b) = n;
+              return;
+            }
+            // First row whose output starts at or after the block target
+            const std::size_t target = total / num_blocks * b + total % num_blocks * b / num_blocks;
+            std::size_t lo = 0;
+            std::size_t hi = n;
+            while (lo < hi) {
+              const std::size_t mid = lo + (hi - lo) / 2;
+              if (offsets(mid) < target) {
+                lo = mid + 1;
+              } else {
+                hi = mid;
+              }
+            }
+            block_row(b) = lo;
+          });
+
+      // A row goes to the scratch unless its output ends in the input of
+      // earlier blocks; counts becomes the staged count
+      Kokkos::parallel_for(
+          "intersection_inplace_classify",
+          Kokkos::RangePolicy<ExecSpace>(exec, 0, n),
+          KOKKOS_LAMBDA(const std::size_t i) {
+            std::size_t b = 0;
+            while (b + 1 < num_blocks && block_row(b + 1) <= i) {
+              ++b;
+            }
+            const bool direct = offsets(i) + counts(i) <= ptr_a(block_row(b));
+            counts(i) = direct ? 0 : counts(i);
+          });
+      staged = IndexView(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "inplace_staged"),
+                         n + 1);
+      subsetix::detail::exclusive_scan_csr_row_ptr<std::size_t>(
+          exec, "intersection_inplace_staged", n, counts, staged);
+
+      IndexView bounds_view(
+          Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "inplace_bounds"),
+          4 * (num_blocks + 1));
+      Kokkos::parallel_for(
+          "intersection_inplace_bounds",
+          Kokkos::RangePolicy<ExecSpace>(exec, 0, num_blocks + 1),
+          KOKKOS_LAMBDA(const std::size_t b) {
+            const std::size_t r = block_row(b);
+            bounds_view(4 * b) = r;
+            bounds_view(4 * b + 1) = offsets(r);
+            bounds_view(4 * b + 2) = ptr_a(r);
+            bounds_view(4 * b + 3) = staged(r);
+          });
+      auto bounds_host = Kokkos::create_mirror_view(bounds_view);
+      Kokkos::deep_copy(exec, bounds_host, bounds_view);
+      exec.fence("intersection_inplace_bounds");
+      bounds.assign(bounds_host.data(), bounds_host.data() + bounds_host.extent(0));
+    }
+    const auto row_at = [&](std::size_t b) { return bounds[4 * b]; };
+    const auto output_at = [&](std::size_t b) { return bounds[4 * b + 1]; };
+    const auto input_at = [&](std::size_t b) { return bounds[4 * b + 2]; };
+    const auto staged_at = [&](std::size_t b) { return bounds[4 * b + 3]; };
+
+    // Staged rows of blocks [run, b] are copied back after block b once
+    // their destinations (below output_at(b + 1)) hold no unread input
+    const auto can_flush = [&](std::size_t b) {
+      return b + 1 == num_blocks || output_at(b + 1) <= input_at(b + 1);
+    };
+    std::size_t scratch_size = 0;
+    for (std::size_t b = 0, run = 0; b < num_blocks; ++b) {
+      const std::size_t pending = staged_at(b + 1) - staged_at(run);
+      scratch_size = (pending > scratch_size) ? pending : scratch_size;
+      run = can_flush(b) ? b + 1 : run;
+    }
+
+    const Region region(exec, "fill");
+    typename MeshType::IntervalView scratch(
+        Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "inplace_scratch"), scratch_size);
+    std::size_t run = 0;
+    for (std::size_t b = 0; b < num_blocks; ++b) {
+      const std::size_t base = staged_at(run);
+      Kokkos::parallel_for(
+          "intersection_inplace_fill",
+          Kokkos::RangePolicy<ExecSpace>(exec, row_at(b), row_at(b + 1)),
+          KOKKOS_LAMBDA(const std::size_t i) {
+            if (offsets(i) == offsets(i + 1)) {
+              return;
+            }
+            const int ib = idx_b(i);
+            if (counts(i) == 0) {
+              detail::row_intersection_impl<detail::WriteIntervals>(
+                  intervals_a, ptr_a(i), ptr_a(i + 1),
+                  intervals_b, ptr_b(ib), ptr_b(ib + 1),
+                  intervals_a, offsets(i));
+            } else {
+              detail::row_intersection_impl<detail::WriteIntervals>(
+                  intervals_a, ptr_a(i), ptr_a(i + 1),
+                  intervals_b, ptr_b(ib), ptr_b(ib + 1),
+                  scratch, staged(i) - base);
+            }
+          });
+
+      if (can_flush(b) && staged_at(b + 1) > base) {
+        Kokkos::parallel_for(
+            "intersection_inplace_flush",
+            Kokkos::RangePolicy<ExecSpace>(exec, row_at(run), row_at(b + 1)),
+            KOKKOS_LAMBDA(const std::size_t i) {
+              for (std::size_t k = 0; k < counts(i); ++k) {
+                intervals_a(offsets(i) + k) = scratch(staged(i) - base + k);
+              }
+            });
+      }
+      run = can_flush(b) ? b + 1 : run;
+    }
+  }
+
+  // Phase 4: Compact row keys and offsets of the non-empty rows
+  {
+    const Region region(exec, "compact");
+    IndexView positions = counts;  // staged counts are no longer needed
+    Kokkos::View<std::size_t, MemorySpace> num_rows_view(
+        Kokkos::view_alloc(exec, "inplace_num_rows"));
+    Kokkos::parallel_scan(
+        "intersection_inplace_row_scan",
+        Kokkos::RangePolicy<ExecSpace>(exec, 0, n),
+        KOKKOS_LAMBDA(const std::size_t i, std::size_t& update, const bool final_pass) {
+          const std::size_t kept = (offsets(i) < offsets(i + 1)) ? 1 : 0;
+          if (final_pass) {
+            positions(i) = update;
+            if (i + 1 == n) {
+              num_rows_view() = update + kept;
+            }
+          }
+          update += kept;
+        });
+    std::size_t num_rows_out = 0;
+    Kokkos::deep_copy(exec, num_rows_out, num_rows_view);
+    exec.fence("intersection_inplace_row_scan");
+
+    // Keys are staged: row i would overwrite the key of a row still read.
+    // Offsets are written directly, nothing reads A.row_ptr anymore
+    typename MeshType::RowKeyView keys_out(
+        Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "inplace_row_keys"), num_rows_out);
+    Kokkos::parallel_for(
+        "intersection_inplace_compact",
+        Kokkos::RangePolicy<ExecSpace>(exec, 0, n),
+        KOKKOS_LAMBDA(const std::size_t i) {
+          if (offsets(i) == offsets(i + 1)) {
+            return;
+          }
+          const std::size_t pos = positions(i);
+          keys_out(pos) = rows_a(i);
+          ptr_a(pos) = offsets(i);
+          if (pos + 1 == num_rows_out) {
+            ptr_a(num_rows_out) = total;
+          }
+        });
+
+    A.row_keys = Kokkos::subview(A.row_keys, std::make_pair(std::size_t(0), num_rows_out));
+    A.row_ptr = Kokkos::subview(A.row_ptr, std::make_pair(std::size_t(0), num_rows_out + 1));
+    Kokkos::deep_copy(exec, A.row_keys, keys_out);
+    A.num_rows = num_rows_out;
+    A.num_intervals = total;
+
+    // keys_out must outlive the asynchronous copy
+    exec.fence("intersection_inplace_copy");
+  }
+}
+
+/**
+ * @brief Replace A by A ∩ B on the default instance of the mesh space.
+ */
+template <class MemorySpace>
+void intersect_inplace(Mesh3D<MemorySpace>& A, const Mesh3D<MemorySpace>& B) {
+  intersect_inplace(typename MemorySpace::execution_space(), A, B);
+}
+
 // ============================================================================
 // Conversion between memory spaces
 // ============================================================================
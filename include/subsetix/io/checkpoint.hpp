@@ -0,0 +1,540 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/field.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace subsetix::io {
+
+/**
+ * @brief Options for checkpoint writing and reading.
+ */
+struct CheckpointOptions {
+  std::size_t chunk_bytes = std::size_t(16) << 20;  // Payload bytes per chunk
+  unsigned num_threads = 0;                         // 0 = hardware concurrency
+};
+
+/**
+ * @brief Mesh hierarchy and fields restored from a checkpoint.
+ *
+ * fields[l] holds the fields laid out on levels[l].
+ */
+template <class T, class MemorySpace>
+struct CheckpointData {
+  std::vector<Mesh3D<MemorySpace>> levels;
+  std::vector<std::vector<NamedField<T, MemorySpace>>> fields;
+};
+
+namespace detail {
+
+// ============================================================================
+// File format
+// ============================================================================
+//
+// [magic u64][version u64]
+// [chunk data ...]                      - chunks of every array, back to back
+// [array table]                         - see ArrayEntry
+// [table offset u64][num arrays u64][magic u64]
+//
+// Every array is split into chunks of at most chunk_bytes. Chunk offsets
+// depend only on array sizes, so all chunks can be written concurrently.
+
+constexpr std::uint64_t CHECKPOINT_MAGIC = 0x54504b4358535342ULL;  // "BSSXCKPT"
+constexpr std::uint64_t CHECKPOINT_VERSION = 1;
+
+struct ChunkEntry {
+  std::uint64_t offset = 0;
+  std::uint64_t bytes = 0;
+  std::uint32_t crc = 0;
+};
+
+struct ArrayEntry {
+  std::string name;
+  std::uint64_t elem_size = 0;
+  std::uint64_t count = 0;
+  std::vector<ChunkEntry> chunks;
+};
+
+// ============================================================================
+// CRC-32 (IEEE 802.3, reflected polynomial 0xEDB88320)
+// ============================================================================
+
+inline const std::array<std::uint32_t, 256>& crc32_table() {
+  static const std::array<std::uint32_t, 256> table = [] {
+    std::array<std::uint32_t, 256> t{};
+    for (std::uint32_t i = 0; i < 256; ++i) {
+      std::uint32_t c = i;
+      for (int k = 0; k < 8; ++k) {
+        c = (c & 1U) ? (0xEDB88320U ^ (c >> 1)) : (c >> 1);
+      }
+      t[i] = c;
+    }
+    return t;
+  }();
+  return table;
+}
+
+inline std::uint32_t crc32(const unsigned char* data, std::size_t n) {
+  const auto& table = crc32_table();
+  std::uint32_t c = 0xFFFFFFFFU;
+  for (std::size_t i = 0; i < n; ++i) {
+    c = table[(c ^ data[i]) & 0xFFU] ^ (c >> 8);
+  }
+  return c ^ 0xFFFFFFFFU;
+}
+
+// ============================================================================
+// Parallel chunk I/O
+// ============================================================================
+
+inline unsigned resolve_threads(unsigned requested) {
+  if (requested > 0) {
+    return requested;
+  }
+  const unsigned hw = std::thread::hardware_concurrency();
+  return hw > 0 ? hw : 1;
+}
+
+/**
+ * @brief Run task(i) for i in [0, n) on a pool of std::threads.
+ *
+ * The first exception thrown by a task is rethrown after all threads join.
+ */
+template <class Task>
+void run_parallel(std::size_t n, unsigned num_threads, const Task& task) {
+  const std::size_t workers = std::min<std::size_t>(num_threads, n);
+  if (workers <= 1) {
+    for (std::size_t i = 0; i < n; ++i) {
+      task(i);
+    }
+    return;
+  }
+
+  std::atomic<std::size_t> next{0};
+  std::exception_ptr error;
+  std::mutex error_mutex;
+  std::vector<std::thread> pool;
+  pool.reserve(workers);
+
+  for (std::size_t w = 0; w < workers; ++w) {
+    pool.emplace_back([&] {
+      for (std::size_t i = next++; i < n; i = next++) {
+        try {
+          task(i);
+        } catch (...) {
+          const std::lock_guard<std::mutex> lock(error_mutex);
+          if (!error) {
+            error = std::current_exception();
+          }
+        }
+      }
+    });
+  }
+  for (auto& t : pool) {
+    t.join();
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+/**
+ * @brief Plan the chunks of an array starting at byte offset cursor.
+ */
+inline ArrayEntry plan_array(const std::string& name,
+                             std::size_t elem_size,
+                             std::size_t count,
+                             std::size_t chunk_bytes,
+                             std::uint64_t& cursor) {
+  ArrayEntry entry;
+  entry.name = name;
+  entry.elem_size = elem_size;
+  entry.count = count;
+
+  // Chunks hold whole elements
+  const std::size_t per_chunk = std::max<std::size_t>(1, chunk_bytes / elem_size) * elem_size;
+  const std::size_t total = elem_size * count;
+  for (std::size_t done = 0; done < total; done += per_chunk) {
+    ChunkEntry chunk;
+    chunk.offset = cursor;
+    chunk.bytes = std::min(per_chunk, total - done);
+    cursor += chunk.bytes;
+    entry.chunks.push_back(chunk);
+  }
+  return entry;
+}
+
+// Write all chunks of one host array concurrently, filling in their checksums
+inline void write_chunks(const std::string& path,
+                         ArrayEntry& entry,
+                         const void* host_data,
+                         unsigned num_threads) {
+  const auto* base = static_cast<const unsigned char*>(host_data);
+  const std::uint64_t first = entry.chunks.empty() ? 0 : entry.chunks.front().offset;
+
+  run_parallel(entry.chunks.size(), num_threads, [&](std::size_t c) {
+    ChunkEntry& chunk = entry.chunks[c];
+    const unsigned char* src = base + (chunk.offset - first);
+    chunk.crc = crc32(src, chunk.bytes);
+
+    std::fstream os(path, std::ios::in | std::ios::out | std::ios::binary);
+    os.seekp(static_cast<std::streamoff>(chunk.offset));
+    os.write(reinterpret_cast<const char*>(src), static_cast<std::streamsize>(chunk.bytes));
+    if (!os) {
+      throw std::runtime_error("subsetix::io: failed writing chunk of '" + entry.name + "'");
+    }
+  });
+}
+
+// Read all chunks of one array concurrently into host memory, verifying checksums
+inline void read_chunks(const std::string& path,
+                        const ArrayEntry& entry,
+                        void* host_data,
+                        unsigned num_threads) {
+  auto* base = static_cast<unsigned char*>(host_data);
+  const std::uint64_t first = entry.chunks.empty() ? 0 : entry.chunks.front().offset;
+
+  run_parallel(entry.chunks.size(), num_threads, [&](std::size_t c) {
+    const ChunkEntry& chunk = entry.chunks[c];
+    unsigned char* dst = base + (chunk.offset - first);
+
+    std::ifstream is(path, std::ios::binary);
+    is.seekg(static_cast<std::streamoff>(chunk.offset));
+    is.read(reinterpret_cast<char*>(dst), static_cast<std::streamsize>(chunk.bytes));
+    if (!is) {
+      throw std::runtime_error("subsetix::io: truncated chunk in '" + entry.name + "'");
+    }
+    if (crc32(dst, chunk.bytes) != chunk.crc) {
+      throw std::runtime_error("subsetix::io: checksum mismatch in '" + entry.name + "'");
+    }
+  });
+}
+
+// ============================================================================
+// Table serialisation
+// ============================================================================
+
+template <class T>
+void put(std::ostream& os, const T& value) {
+  os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <class T>
+T get(std::istream& is) {
+  T value{};
+  is.read(reinterpret_cast<char*>(&value), sizeof(T));
+  if (!is) {
+    throw std::runtime_error("subsetix::io: truncated checkpoint table");
+  }
+  return value;
+}
+
+inline void write_table(std::ostream& os, const std::vector<ArrayEntry>& table) {
+  for (const auto& entry : table) {
+    put<std::uint64_t>(os, entry.name.size());
+    os.write(entry.name.data(), static_cast<std::streamsize>(entry.name.size()));
+    put(os, entry.elem_size);
+    put(os, entry.count);
+    put<std::uint64_t>(os, entry.chunks.size());
+    for (const auto& chunk : entry.chunks) {
+      put(os, chunk.offset);
+      put(os, chunk.bytes);
+      put(os, chunk.crc);
+    }
+  }
+}
+
+// Read the table stored in [data_end, data_end + table_bytes). Every count is
+// checked against the bytes left before anything is allocated, and every
+// array's chunks must be contiguous, lie before data_end and add up to its size.
+inline std::vector<ArrayEntry> read_table(std::istream& is,
+                                          std::uint64_t num_arrays,
+                                          std::uint64_t data_end,
+                                          std::uint64_t table_bytes) {
+  constexpr std::uint64_t entry_min = 4 * sizeof(std::uint64_t);
+  constexpr std::uint64_t chunk_size = 2 * sizeof(std::uint64_t) + sizeof(std::uint32_t);
+  const std::uint64_t table_end = data_end + table_bytes;
+  auto left = [&]() {
+    const auto pos = static_cast<std::uint64_t>(is.tellg());
+    return pos < table_end ? table_end - pos : 0;
+  };
+  auto corrupt = []() {
+    return std::runtime_error("subsetix::io: corrupt checkpoint table");
+  };
+
+  if (num_arrays > table_bytes / entry_min) {
+    throw corrupt();
+  }
+  std::vector<ArrayEntry> table(num_arrays);
+  for (auto& entry : table) {
+    const auto name_size = get<std::uint64_t>(is);
+    if (name_size > left()) {
+      throw corrupt();
+    }
+    entry.name.resize(name_size);
+    is.read(entry.name.data(), static_cast<std::streamsize>(entry.name.size()));
+    entry.elem_size = get<std::uint64_t>(is);
+    entry.count = get<std::uint64_t>(is);
+    const auto num_chunks = get<std::uint64_t>(is);
+    if (num_chunks > left() / chunk_size) {
+      throw corrupt();
+    }
+    entry.chunks.resize(num_chunks);
+    std::uint64_t total = 0;
+    for (std::size_t c = 0; c < entry.chunks.size(); ++c) {
+      auto& chunk = entry.chunks[c];
+      chunk.offset = get<std::uint64_t>(is);
+      chunk.bytes = get<std::uint64_t>(is);
+      chunk.crc = get<std::uint32_t>(is);
+      const bool follows = c == 0 || chunk.offset == entry.chunks[c - 1].offset +
+                                                         entry.chunks[c - 1].bytes;
+      if (!follows || chunk.offset > data_end || chunk.bytes > data_end - chunk.offset) {
+        throw corrupt();
+      }
+      total += chunk.bytes;
+    }
+    if (entry.elem_size != 0 && entry.count > data_end / entry.elem_size) {
+      throw corrupt();
+    }
+    if (total != entry.elem_size * entry.count) {
+      throw corrupt();
+    }
+  }
+  return table;
+}
+
+inline std::string level_prefix(std::size_t level) {
+  return "level/" + std::to_string(level) + "/";
+}
+
+inline const ArrayEntry& find_array(const std::vector<ArrayEntry>& table,
+                                    const std::string& name,
+                                    std::size_t elem_size) {
+  for (const auto& entry : table) {
+    if (entry.name == name) {
+      if (entry.elem_size != elem_size) {
+        throw std::runtime_error("subsetix::io: element size mismatch for '" + name + "'");
+      }
+      return entry;
+    }
+  }
+  throw std::runtime_error("subsetix::io: checkpoint has no array '" + name + "'");
+}
+
+/**
+ * @brief Stage the first count elements of a view on the host and write them.
+ */
+template <class ViewType>
+void write_view(const std::string& path, ArrayEntry& entry, const ViewType& view,
+                std::size_t count, unsigned num_threads) {
+  if (count == 0) {
+    return;
+  }
+  auto used = Kokkos::subview(view, std::make_pair(std::size_t(0), count));
+  auto host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, used);
+  write_chunks(path, entry, host.data(), num_threads);
+}
+
+/**
+ * @brief Read an array into a freshly allocated view of the target space.
+ */
+template <class ViewType>
+ViewType read_view(const std::string& path, const ArrayEntry& entry,
+                   const std::string& label, unsigned num_threads) {
+  using HostView = Kokkos::View<typename ViewType::non_const_value_type*, Kokkos::HostSpace>;
+  HostView host(Kokkos::view_alloc(Kokkos::WithoutInitializing, label), entry.count);
+  read_chunks(path, entry, host.data(), num_threads);
+  return Kokkos::create_mirror_view_and_copy(typename ViewType::memory_space{}, host);
+}
+
+} // namespace detail
+
+/**
+ * @brief Write a mesh hierarchy and its fields to a checkpoint file.
+ *
+ * Each CSR array and field array is split into independent chunks whose
+ * file offsets are planned up front; chunks are then checksummed (CRC-32)
+ * and written concurrently by a pool of host threads. Arrays are staged on
+ * the host one at a time, so host memory is bounded by the largest array.
+ *
+ * @param path Output file (overwritten)
+ * @param levels Meshes of the hierarchy, coarsest first
+ * @param fields fields[l] are the fields laid out on levels[l] (may be shorter)
+ * @throws std::invalid_argument if a field is not laid out on its level
+ * @throws std::runtime_error on I/O failure
+ */
+template <class T, class MemorySpace>
+void checkpoint(const std::string& path,
+                const std::vector<Mesh3D<MemorySpace>>& levels,
+                const std::vector<std::vector<NamedField<T, MemorySpace>>>& fields,
+                const CheckpointOptions& options = {}) {
+  if (fields.size() > levels.size()) {
+    throw std::invalid_argument("subsetix::io: more field levels than mesh levels");
+  }
+  const unsigned num_threads = detail::resolve_threads(options.num_threads);
+  const std::size_t chunk_bytes = std::max<std::size_t>(options.chunk_bytes, 1);
+
+  // Plan every array so chunk offsets are known before any data is written
+  std::uint64_t cursor = 2 * sizeof(std::uint64_t);
+  std::vector<detail::ArrayEntry> table;
+  for (std::size_t l = 0; l < levels.size(); ++l) {
+    const auto& mesh = levels[l];
+    const std::string prefix = detail::level_prefix(l);
+    const std::size_t num_row_ptr = mesh.num_rows > 0 ? mesh.num_rows + 1 : 0;
+    table.push_back(detail::plan_array(prefix + "row_keys", sizeof(RowKey), mesh.num_rows,
+                                       chunk_bytes, cursor));
+    table.push_back(detail::plan_array(prefix + "row_ptr", sizeof(std::size_t), num_row_ptr,
+                                       chunk_bytes, cursor));
+    table.push_back(detail::plan_array(prefix + "intervals", sizeof(Interval),
+                                       mesh.num_intervals, chunk_bytes, cursor));
+    if (l < fields.size()) {
+      for (const auto& f : fields[l]) {
+        if (f.field.interval_offsets.extent(0) != mesh.num_intervals + 1) {
+          throw std::invalid_argument("subsetix::io: field '" + f.name +
+                                      "' is not laid out on level " + std::to_string(l));
+        }
+        table.push_back(detail::plan_array(prefix + "field/" + f.name, sizeof(T),
+                                           f.field.num_cells, chunk_bytes, cursor));
+      }
+    }
+  }
+
+  {
+    std::ofstream os(path, std::ios::binary | std::ios::trunc);
+    if (!os) {
+      throw std::runtime_error("subsetix::io: cannot open '" + path + "' for writing");
+    }
+    detail::put(os, detail::CHECKPOINT_MAGIC);
+    detail::put(os, detail::CHECKPOINT_VERSION);
+  }
+
+  // Write chunk data
+  std::size_t entry = 0;
+  for (std::size_t l = 0; l < levels.size(); ++l) {
+    const auto& mesh = levels[l];
+    detail::write_view(path, table[entry++], mesh.row_keys, mesh.num_rows, num_threads);
+    detail::write_view(path, table[entry++], mesh.row_ptr,
+                       mesh.num_rows > 0 ? mesh.num_rows + 1 : 0, num_threads);
+    detail::write_view(path, table[entry++], mesh.intervals, mesh.num_intervals, num_threads);
+    if (l < fields.size()) {
+      for (const auto& f : fields[l]) {
+        detail::write_view(path, table[entry++], f.field.values, f.field.num_cells,
+                           num_threads);
+      }
+    }
+  }
+
+  // Append table and trailer
+  std::fstream os(path, std::ios::in | std::ios::out | std::ios::binary);
+  os.seekp(static_cast<std::streamoff>(cursor));
+  detail::write_table(os, table);
+  detail::put(os, cursor);
+  detail::put<std::uint64_t>(os, table.size());
+  detail::put(os, detail::CHECKPOINT_MAGIC);
+  if (!os) {
+    throw std::runtime_error("subsetix::io: failed writing checkpoint table to '" + path + "'");
+  }
+}
+
+/**
+ * @brief Restore a mesh hierarchy and fields written by checkpoint().
+ *
+ * Chunks are read concurrently straight into host views, checksums are
+ * verified, and each array is then copied into MemorySpace. Field cell
+ * offsets are recomputed from the restored meshes.
+ *
+ * @throws std::runtime_error on I/O failure, format or checksum mismatch
+ */
+template <class T, class MemorySpace = Kokkos::DefaultExecutionSpace::memory_space>
+CheckpointData<T, MemorySpace> restart(const std::string& path,
+                                       const CheckpointOptions& options = {}) {
+  const unsigned num_threads = detail::resolve_threads(options.num_threads);
+
+  std::ifstream is(path, std::ios::binary);
+  if (!is) {
+    throw std::runtime_error("subsetix::io: cannot open '" + path + "' for reading");
+  }
+  if (detail::get<std::uint64_t>(is) != detail::CHECKPOINT_MAGIC ||
+      detail::get<std::uint64_t>(is) != detail::CHECKPOINT_VERSION) {
+    throw std::runtime_error("subsetix::io: '" + path + "' is not a subsetix checkpoint");
+  }
+  is.seekg(-static_cast<std::streamoff>(3 * sizeof(std::uint64_t)), std::ios::end);
+  const auto trailer = static_cast<std::uint64_t>(is.tellg());
+  const auto table_offset = detail::get<std::uint64_t>(is);
+  const auto num_arrays = detail::get<std::uint64_t>(is);
+  if (detail::get<std::uint64_t>(is) != detail::CHECKPOINT_MAGIC || table_offset > trailer) {
+    throw std::runtime_error("subsetix::io: '" + path + "' has a corrupt trailer");
+  }
+  is.seekg(static_cast<std::streamoff>(table_offset));
+  const auto table = detail::read_table(is, num_arrays, table_offset, trailer - table_offset);
+
+  CheckpointData<T, MemorySpace> out;
+  for (std::size_t l = 0;; ++l) {
+    const std::string prefix = detail::level_prefix(l);
+    const bool has_level = std::any_of(table.begin(), table.end(), [&](const auto& e) {
+      return e.name == prefix + "row_keys";
+    });
+    if (!has_level) {
+      break;
+    }
+
+    using MeshType = Mesh3D<MemorySpace>;
+    MeshType mesh;
+    const auto& keys = detail::find_array(table, prefix + "row_keys", sizeof(RowKey));
+    const auto& ptr = detail::find_array(table, prefix + "row_ptr", sizeof(std::size_t));
+    const auto& ivs = detail::find_array(table, prefix + "intervals", sizeof(Interval));
+    mesh.num_rows = keys.count;
+    mesh.num_intervals = ivs.count;
+    if (mesh.num_rows > 0) {
+      mesh.row_keys = detail::read_view<typename MeshType::RowKeyView>(
+          path, keys, "mesh_row_keys", num_threads);
+      mesh.row_ptr = detail::read_view<typename MeshType::IndexView>(
+          path, ptr, "mesh_row_ptr", num_threads);
+      mesh.intervals = detail::read_view<typename MeshType::IntervalView>(
+          path, ivs, "mesh_intervals", num_threads);
+    }
+
+    std::vector<NamedField<T, MemorySpace>> level_fields;
+    const std::string field_prefix = prefix + "field/";
+    for (const auto& entry : table) {
+      if (entry.name.compare(0, field_prefix.size(), field_prefix) != 0) {
+        continue;
+      }
+      if (entry.elem_size != sizeof(T)) {
+        throw std::runtime_error("subsetix::io: element size mismatch for '" + entry.name + "'");
+      }
+      NamedField<T, MemorySpace> f;
+      f.name = entry.name.substr(field_prefix.size());
+      f.field.num_cells = compute_interval_cell_offsets(mesh, f.field.interval_offsets);
+      if (f.field.num_cells != entry.count) {
+        throw std::runtime_error("subsetix::io: field '" + f.name + "' does not match its mesh");
+      }
+      f.field.values = detail::read_view<typename Field3D<T, MemorySpace>::ValueView>(
+          path, entry, f.name, num_threads);
+      level_fields.push_back(f);
+    }
+
+    out.levels.push_back(mesh);
+    out.fields.push_back(std::move(level_fields));
+  }
+
+  return out;
+}
+
+} // namespace subsetix::io
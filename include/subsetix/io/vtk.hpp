@@ -0,0 +1,524 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/field.hpp>
+#include <subsetix/detail/utils.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace subsetix::io {
+
+/**
+ * @brief Granularity of the hexahedra written to VTK files.
+ */
+enum class VtkCellMode {
+  Interval,  // One hexahedron per X-interval (cells merged along X)
+  Cell       // One hexahedron per cell
+};
+
+/**
+ * @brief Options for the VTU / legacy VTK writers.
+ */
+struct VtkOptions {
+  VtkCellMode mode = VtkCellMode::Interval;
+  std::size_t chunk_size = std::size_t(1) << 18;  // Hexahedra encoded per chunk
+  double spacing = 1.0;                           // Cell edge length
+  std::array<double, 3> origin = {0.0, 0.0, 0.0}; // Physical position of cell (0,0,0)
+};
+
+namespace detail {
+
+// VTK hexahedron cell type id
+constexpr std::uint8_t VTK_HEXAHEDRON = 12;
+
+// ============================================================================
+// Type mapping
+// ============================================================================
+
+template <class T>
+struct VtkType;
+
+template <>
+struct VtkType<float> {
+  static constexpr const char* xml = "Float32";
+  static constexpr const char* legacy = "float";
+};
+template <>
+struct VtkType<double> {
+  static constexpr const char* xml = "Float64";
+  static constexpr const char* legacy = "double";
+};
+template <>
+struct VtkType<std::int32_t> {
+  static constexpr const char* xml = "Int32";
+  static constexpr const char* legacy = "int";
+};
+template <>
+struct VtkType<std::int64_t> {
+  static constexpr const char* xml = "Int64";
+  static constexpr const char* legacy = "vtktypeint64";
+};
+template <>
+struct VtkType<std::uint8_t> {
+  static constexpr const char* xml = "UInt8";
+  static constexpr const char* legacy = "unsigned_char";
+};
+
+// Unsigned word used to stage raw bytes of a value (avoids NaN canonicalisation)
+template <std::size_t N>
+struct WordOf;
+template <>
+struct WordOf<1> { using type = std::uint8_t; };
+template <>
+struct WordOf<2> { using type = std::uint16_t; };
+template <>
+struct WordOf<4> { using type = std::uint32_t; };
+template <>
+struct WordOf<8> { using type = std::uint64_t; };
+
+// ============================================================================
+// Hexahedron lookup
+// ============================================================================
+
+/**
+ * @brief Maps a hexahedron index to its (row, interval, X-range).
+ *
+ * In Interval mode hexahedron h is interval h. In Cell mode hexahedron h is
+ * the h-th cell in traversal order, located through the interval cell offsets.
+ * Both lookups are binary searches, so no per-cell table is materialised.
+ */
+template <class MemorySpace>
+struct HexLocator {
+  typename Mesh3D<MemorySpace>::RowKeyView row_keys;
+  typename Mesh3D<MemorySpace>::IndexView row_ptr;
+  typename Mesh3D<MemorySpace>::IntervalView intervals;
+  Kokkos::View<std::size_t*, MemorySpace> cell_offsets;
+  std::size_t num_rows = 0;
+  std::size_t num_intervals = 0;
+  bool per_cell = false;
+
+  KOKKOS_INLINE_FUNCTION
+  void locate(std::size_t h, std::size_t& k, Coord& x0, Coord& x1) const {
+    if (per_cell) {
+      k = subsetix::detail::find_segment(cell_offsets, num_intervals, h);
+      x0 = intervals(k).begin + static_cast<Coord>(h - cell_offsets(k));
+      x1 = x0 + 1;
+    } else {
+      k = h;
+      x0 = intervals(k).begin;
+      x1 = intervals(k).end;
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  RowKey row_of(std::size_t k) const {
+    return row_keys(subsetix::detail::find_segment(row_ptr, num_rows, k));
+  }
+};
+
+// ============================================================================
+// Chunked streaming
+// ============================================================================
+
+/**
+ * @brief Encode items in parallel chunks and stream the raw bytes to a file.
+ *
+ * Each item produces PerItem values of type Out. A chunk of items is encoded
+ * on the execution space into a staging buffer of unsigned words (byte-swapped
+ * when big_endian is requested), copied to the host and appended to the
+ * stream, so memory use is bounded by the chunk size regardless of mesh size.
+ * Encoding and staging copies are enqueued on exec.
+ *
+ * @return Number of bytes written
+ */
+template <class Out, int PerItem, class MemorySpace, class ExecSpace, class Encoder>
+std::size_t stream_encoded(const ExecSpace& exec,
+                           std::ostream& os,
+                           std::size_t num_items,
+                           std::size_t chunk_items,
+                           bool big_endian,
+                           const Encoder& encode) {
+  using Word = typename WordOf<sizeof(Out)>::type;
+
+  if (num_items == 0) {
+    return 0;
+  }
+  if (chunk_items == 0) {
+    chunk_items = 1;
+  }
+  const std::size_t chunk = (chunk_items < num_items) ? chunk_items : num_items;
+  const bool swap = big_endian != (std::endian::native == std::endian::big);
+
+  Kokkos::View<Word*, MemorySpace> staging(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "vtk_staging"), chunk * PerItem);
+  auto staging_host = Kokkos::create_mirror_view(staging);
+
+  std::size_t written = 0;
+  for (std::size_t first = 0; first < num_items; first += chunk) {
+    const std::size_t count = (num_items - first < chunk) ? (num_items - first) : chunk;
+
+    Kokkos::parallel_for(
+        "vtk_encode_chunk",
+        Kokkos::RangePolicy<ExecSpace>(exec, 0, count),
+        KOKKOS_LAMBDA(const std::size_t i) {
+          Out values[PerItem];
+          encode(first + i, values);
+          for (int j = 0; j < PerItem; ++j) {
+            Word w = Kokkos::bit_cast<Word>(values[j]);
+            if constexpr (sizeof(Word) > 1) {
+              if (swap) {
+                w = Kokkos::byteswap(w);
+              }
+            }
+            staging(i * PerItem + j) = w;
+          }
+        });
+
+    auto staged = Kokkos::subview(staging, std::make_pair(std::size_t(0), count * PerItem));
+    auto staged_host =
+        Kokkos::subview(staging_host, std::make_pair(std::size_t(0), count * PerItem));
+    Kokkos::deep_copy(exec, staged_host, staged);
+    exec.fence("vtk_stage_chunk");
+
+    const std::size_t nbytes = count * PerItem * sizeof(Word);
+    os.write(reinterpret_cast<const char*>(staging_host.data()),
+             static_cast<std::streamsize>(nbytes));
+    written += nbytes;
+  }
+
+  return written;
+}
+
+template <class ExecSpace, class MemorySpace>
+HexLocator<MemorySpace> make_locator(const ExecSpace& exec,
+                                     const Mesh3D<MemorySpace>& mesh,
+                                     const VtkOptions& options,
+                                     std::size_t& num_hex) {
+  HexLocator<MemorySpace> loc;
+  loc.row_keys = mesh.row_keys;
+  loc.row_ptr = mesh.row_ptr;
+  loc.intervals = mesh.intervals;
+  loc.num_rows = mesh.num_rows;
+  loc.num_intervals = mesh.num_intervals;
+  loc.per_cell = options.mode == VtkCellMode::Cell;
+
+  if (loc.per_cell) {
+    num_hex = compute_interval_cell_offsets(exec, mesh, loc.cell_offsets);
+  } else {
+    num_hex = mesh.num_intervals;
+  }
+  return loc;
+}
+
+// Points: 8 corners per hexahedron, 3 components each, VTK corner ordering
+template <class ExecSpace, class MemorySpace>
+std::size_t stream_points(const ExecSpace& exec, std::ostream& os,
+                          const HexLocator<MemorySpace>& loc,
+                          std::size_t num_hex, const VtkOptions& options, bool big_endian) {
+  const double ox = options.origin[0];
+  const double oy = options.origin[1];
+  const double oz = options.origin[2];
+  const double h = options.spacing;
+
+  return stream_encoded<double, 24, MemorySpace>(
+      exec, os, num_hex, options.chunk_size, big_endian,
+      KOKKOS_LAMBDA(const std::size_t hex, double* out) {
+        std::size_t k = 0;
+        Coord x0 = 0;
+        Coord x1 = 0;
+        loc.locate(hex, k, x0, x1);
+        const RowKey key = loc.row_of(k);
+
+        const double xs[2] = {ox + h * x0, ox + h * x1};
+        const double ys[2] = {oy + h * key.y, oy + h * (key.y + 1)};
+        const double zs[2] = {oz + h * key.z, oz + h * (key.z + 1)};
+        const int cx[8] = {0, 1, 1, 0, 0, 1, 1, 0};
+        const int cy[8] = {0, 0, 1, 1, 0, 0, 1, 1};
+        const int cz[8] = {0, 0, 0, 0, 1, 1, 1, 1};
+        for (int c = 0; c < 8; ++c) {
+          out[3 * c + 0] = xs[cx[c]];
+          out[3 * c + 1] = ys[cy[c]];
+          out[3 * c + 2] = zs[cz[c]];
+        }
+      });
+}
+
+// Cell data: per-cell value, or the mean over the interval in Interval mode
+template <class ExecSpace, class T, class MemorySpace>
+std::size_t stream_field(const ExecSpace& exec, std::ostream& os,
+                         const HexLocator<MemorySpace>& loc,
+                         const Field3D<T, MemorySpace>& field, std::size_t num_hex,
+                         const VtkOptions& options, bool big_endian) {
+  auto values = field.values;
+  auto offsets = field.interval_offsets;
+  const bool per_cell = loc.per_cell;
+
+  return stream_encoded<T, 1, MemorySpace>(
+      exec, os, num_hex, options.chunk_size, big_endian,
+      KOKKOS_LAMBDA(const std::size_t hex, T* out) {
+        if (per_cell) {
+          out[0] = values(hex);
+          return;
+        }
+        const std::size_t begin = offsets(hex);
+        const std::size_t end = offsets(hex + 1);
+        double sum = 0.0;
+        for (std::size_t c = begin; c < end; ++c) {
+          sum += static_cast<double>(values(c));
+        }
+        out[0] = static_cast<T>(end > begin ? sum / static_cast<double>(end - begin) : 0.0);
+      });
+}
+
+template <class T, class MemorySpace>
+void check_fields(const Mesh3D<MemorySpace>& mesh,
+                  const std::vector<NamedField<T, MemorySpace>>& fields) {
+  for (const auto& f : fields) {
+    if (f.field.interval_offsets.extent(0) != mesh.num_intervals + 1) {
+      throw std::invalid_argument("subsetix::io: field '" + f.name +
+                                  "' is not laid out on the given mesh");
+    }
+  }
+}
+
+inline std::ofstream open_output(const std::string& path) {
+  std::ofstream os(path, std::ios::binary | std::ios::trunc);
+  if (!os) {
+    throw std::runtime_error("subsetix::io: cannot open '" + path + "' for writing");
+  }
+  return os;
+}
+
+} // namespace detail
+
+/**
+ * @brief Write a mesh and cell fields as a VTK XML unstructured grid (.vtu).
+ *
+ * Arrays are stored as raw appended binary data. Their sizes are known from
+ * the mesh up front, so the XML header is written first and each array is
+ * then streamed in chunks of options.chunk_size hexahedra, encoded in parallel
+ * on the mesh memory space. The mesh is never expanded into a dense cell list.
+ *
+ * In Interval mode each hexahedron carries the mean of its cells' values.
+ * Encoding kernels and staging copies are enqueued on exec.
+ *
+ * @throws std::runtime_error if the file cannot be written
+ * @throws std::invalid_argument if a field is not laid out on mesh
+ */
+template <class ExecSpace, class T, class MemorySpace>
+void write_vtu(const ExecSpace& exec,
+               const std::string& path,
+               const Mesh3D<MemorySpace>& mesh,
+               const std::vector<NamedField<T, MemorySpace>>& fields,
+               const VtkOptions& options = {}) {
+  detail::check_fields(mesh, fields);
+
+  std::size_t num_hex = 0;
+  const auto loc = detail::make_locator(exec, mesh, options, num_hex);
+  const bool big_endian = std::endian::native == std::endian::big;
+
+  // Byte offsets of each appended block (UInt64 size header + payload)
+  std::vector<std::uint64_t> offsets;
+  std::uint64_t cursor = 0;
+  auto add_block = [&](std::uint64_t payload) {
+    offsets.push_back(cursor);
+    cursor += sizeof(std::uint64_t) + payload;
+  };
+  const std::uint64_t n = num_hex;
+  add_block(n * 24 * sizeof(double));         // points
+  add_block(n * 8 * sizeof(std::int64_t));    // connectivity
+  add_block(n * sizeof(std::int64_t));        // offsets
+  add_block(n * sizeof(std::uint8_t));        // types
+  for (std::size_t f = 0; f < fields.size(); ++f) {
+    add_block(n * sizeof(T));
+  }
+
+  auto os = detail::open_output(path);
+  os << "<?xml version=\"1.0\"?>\n"
+     << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\""
+     << (big_endian ? "BigEndian" : "LittleEndian") << "\" header_type=\"UInt64\">\n"
+     << "  <UnstructuredGrid>\n"
+     << "    <Piece NumberOfPoints=\"" << 8 * n << "\" NumberOfCells=\"" << n << "\">\n"
+     << "      <Points>\n"
+     << "        <DataArray type=\"Float64\" NumberOfComponents=\"3\" format=\"appended\""
+     << " offset=\"" << offsets[0] << "\"/>\n"
+     << "      </Points>\n"
+     << "      <Cells>\n"
+     << "        <DataArray type=\"Int64\" Name=\"connectivity\" format=\"appended\""
+     << " offset=\"" << offsets[1] << "\"/>\n"
+     << "        <DataArray type=\"Int64\" Name=\"offsets\" format=\"appended\""
+     << " offset=\"" << offsets[2] << "\"/>\n"
+     << "        <DataArray type=\"UInt8\" Name=\"types\" format=\"appended\""
+     << " offset=\"" << offsets[3] << "\"/>\n"
+     << "      </Cells>\n"
+     << "      <CellData>\n";
+  for (std::size_t f = 0; f < fields.size(); ++f) {
+    os << "        <DataArray type=\"" << detail::VtkType<T>::xml << "\" Name=\""
+       << fields[f].name << "\" format=\"appended\" offset=\"" << offsets[4 + f] << "\"/>\n";
+  }
+  os << "      </CellData>\n"
+     << "    </Piece>\n"
+     << "  </UnstructuredGrid>\n"
+     << "  <AppendedData encoding=\"raw\">\n"
+     << "   _";
+
+  auto write_header = [&](std::uint64_t payload) {
+    os.write(reinterpret_cast<const char*>(&payload), sizeof(payload));
+  };
+
+  write_header(n * 24 * sizeof(double));
+  detail::stream_points(exec, os, loc, num_hex, options, big_endian);
+
+  write_header(n * 8 * sizeof(std::int64_t));
+  detail::stream_encoded<std::int64_t, 8, MemorySpace>(
+      exec, os, num_hex, options.chunk_size, big_endian,
+      KOKKOS_LAMBDA(const std::size_t hex, std::int64_t* out) {
+        for (int c = 0; c < 8; ++c) {
+          out[c] = static_cast<std::int64_t>(8 * hex + c);
+        }
+      });
+
+  write_header(n * sizeof(std::int64_t));
+  detail::stream_encoded<std::int64_t, 1, MemorySpace>(
+      exec, os, num_hex, options.chunk_size, big_endian,
+      KOKKOS_LAMBDA(const std::size_t hex, std::int64_t* out) {
+        out[0] = static_cast<std::int64_t>(8 * (hex + 1));
+      });
+
+  write_header(n * sizeof(std::uint8_t));
+  detail::stream_encoded<std::uint8_t, 1, MemorySpace>(
+      exec, os, num_hex, options.chunk_size, big_endian,
+      KOKKOS_LAMBDA(const std::size_t, std::uint8_t* out) { out[0] = detail::VTK_HEXAHEDRON; });
+
+  for (const auto& f : fields) {
+    write_header(n * sizeof(T));
+    detail::stream_field(exec, os, loc, f.field, num_hex, options, big_endian);
+  }
+
+  os << "\n  </AppendedData>\n"
+     << "</VTKFile>\n";
+
+  if (!os) {
+    throw std::runtime_error("subsetix::io: write to '" + path + "' failed");
+  }
+}
+
+template <class T, class MemorySpace>
+void write_vtu(const std::string& path,
+               const Mesh3D<MemorySpace>& mesh,
+               const std::vector<NamedField<T, MemorySpace>>& fields,
+               const VtkOptions& options = {}) {
+  write_vtu(typename MemorySpace::execution_space(), path, mesh, fields, options);
+}
+
+/**
+ * @brief Write a mesh without attached fields as a .vtu file.
+ */
+template <class MemorySpace>
+void write_vtu(const std::string& path,
+               const Mesh3D<MemorySpace>& mesh,
+               const VtkOptions& options = {}) {
+  write_vtu(path, mesh, std::vector<NamedField<double, MemorySpace>>{}, options);
+}
+
+/**
+ * @brief Write a mesh and cell fields as a legacy binary VTK file (.vtk).
+ *
+ * Uses the 5.1 legacy layout (OFFSETS/CONNECTIVITY with 64-bit indices) so
+ * meshes above 2^31 points are representable. Legacy binary data is
+ * big-endian; byte swapping happens inside the parallel encoding kernels,
+ * which are enqueued on exec.
+ *
+ * @throws std::runtime_error if the file cannot be written
+ * @throws std::invalid_argument if a field is not laid out on mesh
+ */
+template <class ExecSpace, class T, class MemorySpace>
+void write_vtk(const ExecSpace& exec,
+               const std::string& path,
+               const Mesh3D<MemorySpace>& mesh,
+               const std::vector<NamedField<T, MemorySpace>>& fields,
+               const VtkOptions& options = {}) {
+  detail::check_fields(mesh, fields);
+
+  std::size_t num_hex = 0;
+  const auto loc = detail::make_locator(exec, mesh, options, num_hex);
+  const std::uint64_t n = num_hex;
+
+  auto os = detail::open_output(path);
+  os << "# vtk DataFile Version 5.1\n"
+     << "subsetix Mesh3D\n"
+     << "BINARY\n"
+     << "DATASET UNSTRUCTURED_GRID\n"
+     << "POINTS " << 8 * n << " double\n";
+  detail::stream_points(exec, os, loc, num_hex, options, true);
+
+  os << "\nCELLS " << n + 1 << " " << 8 * n << "\n"
+     << "OFFSETS vtktypeint64\n";
+  detail::stream_encoded<std::int64_t, 1, MemorySpace>(
+      exec, os, num_hex + 1, options.chunk_size, true,
+      KOKKOS_LAMBDA(const std::size_t i, std::int64_t* out) {
+        out[0] = static_cast<std::int64_t>(8 * i);
+      });
+
+  os << "\nCONNECTIVITY vtktypeint64\n";
+  detail::stream_encoded<std::int64_t, 8, MemorySpace>(
+      exec, os, num_hex, options.chunk_size, true,
+      KOKKOS_LAMBDA(const std::size_t hex, std::int64_t* out) {
+        for (int c = 0; c < 8; ++c) {
+          out[c] = static_cast<std::int64_t>(8 * hex + c);
+        }
+      });
+
+  os << "\nCELL_TYPES " << n << "\n";
+  detail::stream_encoded<std::int32_t, 1, MemorySpace>(
+      exec, os, num_hex, options.chunk_size, true,
+      KOKKOS_LAMBDA(const std::size_t, std::int32_t* out) { out[0] = detail::VTK_HEXAHEDRON; });
+  os << "\n";
+
+  if (!fields.empty()) {
+    os << "CELL_DATA " << n << "\n";
+    for (const auto& f : fields) {
+      os << "SCALARS " << f.name << " " << detail::VtkType<T>::legacy << " 1\n"
+         << "LOOKUP_TABLE default\n";
+      detail::stream_field(exec, os, loc, f.field, num_hex, options, true);
+      os << "\n";
+    }
+  }
+
+  if (!os) {
+    throw std::runtime_error("subsetix::io: write to '" + path + "' failed");
+  }
+}
+
+template <class T, class MemorySpace>
+void write_vtk(const std::string& path,
+               const Mesh3D<MemorySpace>& mesh,
+               const std::vector<NamedField<T, MemorySpace>>& fields,
+               const VtkOptions& options = {}) {
+  write_vtk(typename MemorySpace::execution_space(), path, mesh, fields, options);
+}
+
+/**
+ * @brief Write a mesh without attached fields as a legacy .vtk file.
+ */
+template <class MemorySpace>
+void write_vtk(const std::string& path,
+               const Mesh3D<MemorySpace>& mesh,
+               const VtkOptions& options = {}) {
+  write_vtk(path, mesh, std::vector<NamedField<double, MemorySpace>>{}, options);
+}
+
+} // namespace subsetix::io
@@ -57,6 +57,27 @@ struct RowKey {
   }
 };
 
+/**
+ * @brief Axis-aligned box of cells, [lo, hi) on each axis (x, y, z).
+ */
+struct CellBox {
+  Coord lo[3] = {0, 0, 0};  // Inclusive
+  Coord hi[3] = {0, 0, 0};  // Exclusive
+
+  KOKKOS_INLINE_FUNCTION
+  bool empty() const {
+    return lo[0] >= hi[0] || lo[1] >= hi[1] || lo[2] >= hi[2];
+  }
+};
+
+/**
+ * @brief Which cells count as neighbours of a cell.
+ *
+ * Face: the 6 cells sharing a face; Edge: also the 12 sharing an edge;
+ * Vertex: all 26 cells of the surrounding 3x3x3 block.
+ */
+enum class Connectivity { Face, Edge, Vertex };
+
 /**
  * @brief CSR-based 3D mesh representation using interval sets.
  *
@@ -0,0 +1,206 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/profiling.hpp>
+#include <subsetix/detail/utils.hpp>
+#include <subsetix/intersection/v1.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace subsetix {
+
+/**
+ * @brief Overlap metrics between two meshes (e.g. predicted vs reference mask).
+ */
+struct MeshMetrics {
+  std::size_t cells_a = 0;
+  std::size_t cells_b = 0;
+  std::size_t intersection_cells = 0;  // |A ∩ B|
+  std::size_t union_cells = 0;         // |A ∪ B|
+  double iou = 1.0;                    // |A ∩ B| / |A ∪ B|; 1 when both are empty
+
+  // Largest Hausdorff distance along x, in cells, between the two versions
+  // of a row present in both meshes (0 if no row is shared)
+  std::int64_t max_row_distance = 0;
+  // Rows present in only one of the meshes (infinitely far in the above sense)
+  std::size_t unmatched_rows = 0;
+};
+
+namespace detail {
+
+// ============================================================================
+// Row walks of the metrics reduction
+// ============================================================================
+
+/**
+ * @brief Largest distance along x from a cell of row p to the nearest cell of
+ *        row q (both rows non-empty).
+ *
+ * Walks p once with a pointer into q: each piece of p outside q lies in a
+ * gap of q, where the distance is a tent between the gap ends, so its
+ * maximum is found in O(1).
+ */
+template <class IntervalViewP, class IntervalViewQ>
+KOKKOS_INLINE_FUNCTION
+std::int64_t row_directed_distance(const IntervalViewP& p, std::size_t begin_p,
+                                   std::size_t end_p, const IntervalViewQ& q,
+                                   std::size_t begin_q, std::size_t end_q) {
+  std::int64_t result = 0;
+  std::size_t jq = begin_q;
+  for (std::size_t ip = begin_p; ip < end_p; ++ip) {
+    const std::int64_t s = p(ip).begin;
+    const std::int64_t e = p(ip).end;
+    while (jq < end_q && q(jq).end <= s) {
+      ++jq;
+    }
+
+    std::int64_t x = s;
+    std::size_t j = jq;
+    while (x < e) {
+      if (j < end_q && q(j).begin <= x) {
+        x = (q(j).end > x) ? static_cast<std::int64_t>(q(j).end) : x;  // covered by q
+        ++j;
+        continue;
+      }
+      // Piece [x, b) in the gap between q(j - 1) and q(j)
+      const bool has_left = j > begin_q;
+      const bool has_right = j < end_q;
+      const std::int64_t b =
+          (has_right && q(j).begin < e) ? static_cast<std::int64_t>(q(j).begin) : e;
+      const std::int64_t last_left = has_left ? static_cast<std::int64_t>(q(j - 1).end) - 1 : 0;
+      const std::int64_t first_right = has_right ? static_cast<std::int64_t>(q(j).begin) : 0;
+
+      std::int64_t d = 0;
+      if (!has_left) {
+        d = first_right - x;
+      } else if (!has_right) {
+        d = (b - 1) - last_left;
+      } else {
+        // Tent min(c - last_left, first_right - c), peak near the gap middle
+        std::int64_t c = last_left + (first_right - last_left) / 2;
+        c = (c < x) ? x : (c > b - 1) ? b - 1 : c;
+        const std::int64_t d0 = (c - last_left < first_right - c) ? c - last_left : first_right - c;
+        const std::int64_t c1 = (c + 1 > b - 1) ? b - 1 : c + 1;
+        const std::int64_t d1 =
+            (c1 - last_left < first_right - c1) ? c1 - last_left : first_right - c1;
+        d = (d0 > d1) ? d0 : d1;
+      }
+      result = (d > result) ? d : result;
+      x = b;
+    }
+  }
+  return result;
+}
+
+} // namespace detail
+
+// ============================================================================
+// Metrics
+// ============================================================================
+
+/**
+ * @brief |A ∩ B|, |A ∪ B|, IoU and the largest per-row distance of two meshes.
+ *
+ * A single reduction launch over the rows of A and of B, without
+ * materialising the intersection or the union. A row of A present in B is
+ * walked three times: the CountCells merge shared with the intersection,
+ * then one pass per directed x distance. A row of B only checks whether A
+ * has it. |A ∪ B| = |A| + |B| - |A ∩ B|.
+ *
+ * @param exec Execution space instance the kernels are enqueued on
+ * @param A First mesh (e.g. prediction)
+ * @param B Second mesh (e.g. reference)
+ * @return Metrics of the pair
+ */
+template <class ExecSpace, class MemorySpace>
+MeshMetrics compare_meshes(const ExecSpace& exec,
+                           const Mesh3D<MemorySpace>& A,
+                           const Mesh3D<MemorySpace>& B) {
+  static_assert(Kokkos::SpaceAccessibility<ExecSpace, MemorySpace>::accessible,
+                "compare_meshes: execution space cannot access the mesh memory space");
+
+  const profiling::ScopedRegion<ExecSpace> op_region(exec, "compare_meshes");
+
+  const std::size_t num_rows_a = A.num_rows;
+  const std::size_t num_rows_b = B.num_rows;
+  auto rows_a = A.row_keys;
+  auto rows_b = B.row_keys;
+  auto row_ptr_a = A.row_ptr;
+  auto row_ptr_b = B.row_ptr;
+  auto intervals_a = A.intervals;
+  auto intervals_b = B.intervals;
+
+  std::size_t cells_a = 0;
+  std::size_t cells_b = 0;
+  std::size_t overlap = 0;
+  std::size_t unmatched = 0;
+  std::int64_t max_distance = 0;
+  Kokkos::parallel_reduce(
+      "mesh_metrics",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, num_rows_a + num_rows_b),
+      KOKKOS_LAMBDA(const std::size_t t, std::size_t& sum_a, std::size_t& sum_b,
+                    std::size_t& sum_overlap, std::size_t& sum_unmatched,
+                    std::int64_t& max_d) {
+        if (t >= num_rows_a) {
+          // Row of B: its cells, and whether A lacks it
+          const std::size_t i = t - num_rows_a;
+          for (std::size_t k = row_ptr_b(i); k < row_ptr_b(i + 1); ++k) {
+            sum_b += static_cast<std::size_t>(static_cast<std::int64_t>(intervals_b(k).end) -
+                                              intervals_b(k).begin);
+          }
+          const RowKey key = rows_b(i);
+          if (detail::find_row_by_yz(rows_a, num_rows_a, key.y, key.z) < 0) {
+            ++sum_unmatched;
+          }
+          return;
+        }
+
+        const std::size_t i = t;
+        for (std::size_t k = row_ptr_a(i); k < row_ptr_a(i + 1); ++k) {
+          sum_a += static_cast<std::size_t>(static_cast<std::int64_t>(intervals_a(k).end) -
+                                            intervals_a(k).begin);
+        }
+        const RowKey key = rows_a(i);
+        const int j = detail::find_row_by_yz(rows_b, num_rows_b, key.y, key.z);
+        if (j < 0) {
+          ++sum_unmatched;
+          return;
+        }
+        const auto r = detail::extract_row_ranges(static_cast<int>(i), j, row_ptr_a, row_ptr_b);
+        sum_overlap += static_cast<std::size_t>(
+            intersection::v1::detail::row_intersection_impl<intersection::v1::detail::CountCells>(
+                intervals_a, r.begin_a, r.end_a, intervals_b, r.begin_b, r.end_b));
+        const std::int64_t d_ab = detail::row_directed_distance(
+            intervals_a, r.begin_a, r.end_a, intervals_b, r.begin_b, r.end_b);
+        const std::int64_t d_ba = detail::row_directed_distance(
+            intervals_b, r.begin_b, r.end_b, intervals_a, r.begin_a, r.end_a);
+        const std::int64_t d = (d_ab > d_ba) ? d_ab : d_ba;
+        max_d = (d > max_d) ? d : max_d;
+      },
+      cells_a, cells_b, overlap, unmatched, Kokkos::Max<std::int64_t>(max_distance));
+  exec.fence("mesh_metrics");
+
+  MeshMetrics m;
+  m.cells_a = cells_a;
+  m.cells_b = cells_b;
+  m.intersection_cells = overlap;
+  m.union_cells = cells_a + cells_b - overlap;
+  m.iou = (m.union_cells == 0)
+              ? 1.0
+              : static_cast<double>(overlap) / static_cast<double>(m.union_cells);
+  m.max_row_distance = (max_distance > 0) ? max_distance : 0;  // Max starts at the lowest value
+  m.unmatched_rows = unmatched;
+  return m;
+}
+
+template <class MemorySpace>
+MeshMetrics compare_meshes(const Mesh3D<MemorySpace>& A, const Mesh3D<MemorySpace>& B) {
+  return compare_meshes(typename MemorySpace::execution_space(), A, B);
+}
+
+} // namespace subsetix
@@ -0,0 +1,346 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/partition.hpp>
+#include <subsetix/detail/utils.hpp>
+#include <subsetix/detail/sfc.hpp>
+#include <subsetix/intersection/v1.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Sort.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+namespace subsetix {
+
+/**
+ * @brief Locality ordering of the rows of a mesh.
+ *
+ * Rows are grouped in square tiles of 2^block_bits x 2^block_bits (y, z)
+ * rows, tiles are visited along the curve and rows inside a tile are kept
+ * in lexicographic order. Unlike the canonical order, both the +-y and the
+ * +-z neighbours of a row are stored nearby.
+ */
+struct RowOrdering {
+  CurveType curve = CurveType::Morton;
+  int block_bits = 2;  // in [0, 31]
+};
+
+/**
+ * @brief Mesh whose rows are stored in a locality order instead of (y, z) order.
+ *
+ * Curve keys are anchored at y = z = 0 (not at the mesh bounding box), so
+ * the order depends on (y, z) alone: every sub-mesh or set-operation result
+ * keeps the order of its input. The price is a seam at zero: the four
+ * quadrants around (0, 0) are visited one after the other, so rows on
+ * opposite sides of y = 0 or z = 0 are stored far apart. Meshes that
+ * straddle zero keep locality inside each quadrant only.
+ *
+ * Invariants:
+ * - mesh satisfies the Mesh3D invariants except row_keys sorting
+ * - to_canonical(i) is the canonical (sorted) rank of stored row i
+ * - from_canonical(to_canonical(i)) == i
+ */
+template <class MemorySpace>
+struct OrderedMesh3D {
+  using IndexView = Kokkos::View<std::size_t*, MemorySpace>;
+
+  Mesh3D<MemorySpace> mesh;  // Rows in locality order
+  IndexView to_canonical;    // [num_rows] - stored index -> canonical index
+  IndexView from_canonical;  // [num_rows] - canonical index -> stored index
+  RowOrdering ordering;
+};
+
+using OrderedMesh3DDevice = OrderedMesh3D<Kokkos::DefaultExecutionSpace::memory_space>;
+
+namespace detail {
+
+/**
+ * @brief Row keys of an ordered mesh, viewed in canonical order.
+ *
+ * Indexable like a RowKeyView so find_row_by_yz can binary-search it.
+ */
+template <class MemorySpace>
+struct CanonicalRowKeys {
+  typename Mesh3D<MemorySpace>::RowKeyView rows;
+  Kokkos::View<std::size_t*, MemorySpace> from_canonical;
+
+  KOKKOS_INLINE_FUNCTION
+  RowKey operator()(std::size_t c) const { return rows(from_canonical(c)); }
+};
+
+/**
+ * @brief Row lookup in an ordered mesh; returns the storage index or -1.
+ */
+template <class MemorySpace>
+struct OrderedRowFinder {
+  CanonicalRowKeys<MemorySpace> keys;
+  std::size_t num_rows = 0;
+
+  KOKKOS_INLINE_FUNCTION
+  int operator()(Coord y, Coord z) const {
+    const int c = find_row_by_yz(keys, num_rows, y, z);
+    return (c < 0) ? -1 : static_cast<int>(keys.from_canonical(static_cast<std::size_t>(c)));
+  }
+};
+
+/**
+ * @brief Fill the to/from canonical permutations of rows stored in any order.
+ */
+template <class ExecSpace, class MemorySpace>
+void build_canonical_permutation(const ExecSpace& exec,
+                                 const Mesh3D<MemorySpace>& mesh,
+                                 Kokkos::View<std::size_t*, MemorySpace>& to_canonical,
+                                 Kokkos::View<std::size_t*, MemorySpace>& from_canonical) {
+  const std::size_t n = mesh.num_rows;
+
+  to_canonical = Kokkos::View<std::size_t*, MemorySpace>(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "to_canonical"), n);
+  from_canonical = Kokkos::View<std::size_t*, MemorySpace>(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "from_canonical"), n);
+  if (n == 0) {
+    return;
+  }
+
+  Kokkos::View<std::uint64_t*, MemorySpace> keys(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "canonical_keys"), n);
+  auto rows = mesh.row_keys;
+  auto from = from_canonical;
+  auto to = to_canonical;
+  Kokkos::parallel_for(
+      "ordering_canonical_keys",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, n),
+      KOKKOS_LAMBDA(const std::size_t i) {
+        keys(i) = canonical_row_key(rows(i).y, rows(i).z);
+        from(i) = i;
+      });
+
+  Kokkos::Experimental::sort_by_key(exec, keys, from);
+
+  Kokkos::parallel_for(
+      "ordering_invert_permutation",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, n),
+      KOKKOS_LAMBDA(const std::size_t c) { to(from(c)) = c; });
+}
+
+template <class MemorySpace>
+void build_canonical_permutation(const Mesh3D<MemorySpace>& mesh,
+                                 Kokkos::View<std::size_t*, MemorySpace>& to_canonical,
+                                 Kokkos::View<std::size_t*, MemorySpace>& from_canonical) {
+  build_canonical_permutation(typename MemorySpace::execution_space(), mesh, to_canonical,
+                              from_canonical);
+}
+
+} // namespace detail
+
+/**
+ * @brief Store the rows of a canonical mesh in a locality order.
+ *
+ * @param exec Execution space instance the operation is enqueued on
+ * @param mesh Canonical mesh (rows sorted by (y, z))
+ * @param ordering Curve and tile size
+ * @throws std::invalid_argument if ordering.block_bits is outside [0, 31]
+ */
+template <class ExecSpace, class MemorySpace>
+OrderedMesh3D<MemorySpace> reorder_rows(const ExecSpace& exec,
+                                        const Mesh3D<MemorySpace>& mesh,
+                                        const RowOrdering& ordering = {}) {
+  using IndexView = Kokkos::View<std::size_t*, MemorySpace>;
+  static_assert(Kokkos::SpaceAccessibility<ExecSpace, MemorySpace>::accessible,
+                "reorder_rows: execution space cannot access the mesh memory space");
+
+  if (ordering.block_bits < 0 || ordering.block_bits > 31) {
+    throw std::invalid_argument("subsetix::reorder_rows: block_bits must be in [0, 31]");
+  }
+
+  const std::size_t n = mesh.num_rows;
+  OrderedMesh3D<MemorySpace> out;
+  out.ordering = ordering;
+  out.to_canonical =
+      IndexView(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "to_canonical"), n);
+  out.from_canonical =
+      IndexView(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "from_canonical"), n);
+  if (n == 0) {
+    return out;
+  }
+
+  const CurveType curve = ordering.curve;
+  const int block_bits = ordering.block_bits;
+
+  Kokkos::View<std::uint64_t*, MemorySpace> keys(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "ordering_keys"), n);
+  auto rows = mesh.row_keys;
+  auto to = out.to_canonical;
+  Kokkos::parallel_for(
+      "ordering_curve_keys",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, n),
+      KOKKOS_LAMBDA(const std::size_t i) {
+        keys(i) = detail::origin_row_curve_key(curve, rows(i).y, rows(i).z, block_bits);
+        to(i) = i;
+      });
+
+  // Sorting canonical indices by curve key yields stored -> canonical
+  Kokkos::Experimental::sort_by_key(exec, keys, to);
+
+  auto from = out.from_canonical;
+  Kokkos::parallel_for(
+      "ordering_invert_permutation",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, n),
+      KOKKOS_LAMBDA(const std::size_t i) { from(to(i)) = i; });
+
+  out.mesh = extract_rows(exec, mesh, out.to_canonical);
+  return out;
+}
+
+template <class MemorySpace>
+OrderedMesh3D<MemorySpace> reorder_rows(const Mesh3D<MemorySpace>& mesh,
+                                        const RowOrdering& ordering = {}) {
+  return reorder_rows(typename MemorySpace::execution_space(), mesh, ordering);
+}
+
+/**
+ * @brief Convert an ordered mesh back to the canonical (y, z) row order.
+ */
+template <class ExecSpace, class MemorySpace>
+Mesh3D<MemorySpace> canonicalize(const ExecSpace& exec,
+                                 const OrderedMesh3D<MemorySpace>& ordered) {
+  return extract_rows(exec, ordered.mesh, ordered.from_canonical);
+}
+
+template <class MemorySpace>
+Mesh3D<MemorySpace> canonicalize(const OrderedMesh3D<MemorySpace>& ordered) {
+  return canonicalize(typename MemorySpace::execution_space(), ordered);
+}
+
+/**
+ * @brief Device-callable row lookup (storage index or -1) in an ordered mesh.
+ */
+template <class MemorySpace>
+detail::OrderedRowFinder<MemorySpace> row_finder(const OrderedMesh3D<MemorySpace>& ordered) {
+  return detail::OrderedRowFinder<MemorySpace>{
+      {ordered.mesh.row_keys, ordered.from_canonical}, ordered.mesh.num_rows};
+}
+
+} // namespace subsetix
+
+namespace subsetix::intersection::v1 {
+
+namespace detail {
+
+/**
+ * @brief Canonical permutations of an intersection of an ordered mesh A.
+ *
+ * The result rows are a subsequence of the rows of A, so their canonical
+ * ranks follow from those of A: kept rows of A are flagged in canonical
+ * order, and an exclusive scan of the flags gives the rank of each kept
+ * row. O(n), no sort.
+ */
+template <class ExecSpace, class MemorySpace>
+void ordered_intersection_permutation(const ExecSpace& exec,
+                                      const IntersectionWorkspace<MemorySpace>& ws,
+                                      const OrderedMesh3D<MemorySpace>& A,
+                                      OrderedMesh3D<MemorySpace>& out) {
+  using IndexView = Kokkos::View<std::size_t*, MemorySpace>;
+
+  const std::size_t n = out.mesh.num_rows;
+  out.to_canonical =
+      IndexView(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "to_canonical"), n);
+  out.from_canonical =
+      IndexView(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "from_canonical"), n);
+  if (n == 0) {
+    return;
+  }
+
+  const std::size_t num_rows_a = A.mesh.num_rows;
+  const std::size_t num_rows_out = ws.num_rows_out;
+  auto a_to_canonical = A.to_canonical;
+  auto out_idx_a = ws.out_idx_a;
+  auto has_intervals = ws.has_intervals;
+  auto new_positions = ws.new_positions;
+
+  IndexView kept(Kokkos::view_alloc(exec, "ordering_kept_rows"), num_rows_a);
+  Kokkos::parallel_for(
+      "ordering_kept_rows",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, num_rows_out),
+      KOKKOS_LAMBDA(const std::size_t j) {
+        if (has_intervals(j)) {
+          kept(a_to_canonical(static_cast<std::size_t>(out_idx_a(j)))) = 1;
+        }
+      });
+
+  IndexView rank(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "ordering_kept_rank"),
+                 num_rows_a + 1);
+  subsetix::detail::exclusive_scan_csr_row_ptr<std::size_t>(exec, "ordering_kept_scan",
+                                                            num_rows_a, kept, rank);
+
+  auto to = out.to_canonical;
+  auto from = out.from_canonical;
+  Kokkos::parallel_for(
+      "ordering_intersection_permutation",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, num_rows_out),
+      KOKKOS_LAMBDA(const std::size_t j) {
+        if (has_intervals(j)) {
+          const std::size_t k = new_positions(j);
+          const std::size_t c = rank(a_to_canonical(static_cast<std::size_t>(out_idx_a(j))));
+          to(k) = c;
+          from(c) = k;
+        }
+      });
+}
+
+} // namespace detail
+
+/**
+ * @brief Intersection of two ordered meshes.
+ *
+ * Rows of B are located through its canonical permutation, so neither input
+ * is re-sorted. The result keeps the row order of A, and its permutations
+ * are derived from those of A without sorting. All work is enqueued on
+ * exec.
+ */
+template <class ExecSpace, class MemorySpace>
+OrderedMesh3D<MemorySpace> intersect_meshes(const ExecSpace& exec,
+                                            const OrderedMesh3D<MemorySpace>& A,
+                                            const OrderedMesh3D<MemorySpace>& B) {
+  detail::IntersectionWorkspace<MemorySpace> ws;
+  OrderedMesh3D<MemorySpace> out;
+  out.ordering = A.ordering;
+  out.mesh = detail::intersect_with_row_finder(exec, ws, A.mesh, B.mesh, row_finder(B));
+  detail::ordered_intersection_permutation(exec, ws, A, out);
+  return out;
+}
+
+template <class MemorySpace>
+OrderedMesh3D<MemorySpace> intersect_meshes(const OrderedMesh3D<MemorySpace>& A,
+                                            const OrderedMesh3D<MemorySpace>& B) {
+  return intersect_meshes(typename MemorySpace::execution_space(), A, B);
+}
+
+/**
+ * @brief Intersection of an ordered mesh with a canonical mesh (order of A kept).
+ */
+template <class ExecSpace, class MemorySpace>
+OrderedMesh3D<MemorySpace> intersect_meshes(const ExecSpace& exec,
+                                            const OrderedMesh3D<MemorySpace>& A,
+                                            const Mesh3D<MemorySpace>& B) {
+  using RowKeyView = typename Mesh3D<MemorySpace>::RowKeyView;
+  detail::IntersectionWorkspace<MemorySpace> ws;
+  OrderedMesh3D<MemorySpace> out;
+  out.ordering = A.ordering;
+  out.mesh = detail::intersect_with_row_finder(
+      exec, ws, A.mesh, B, detail::SortedRowFinder<RowKeyView>{B.row_keys, B.num_rows});
+  detail::ordered_intersection_permutation(exec, ws, A, out);
+  return out;
+}
+
+template <class MemorySpace>
+OrderedMesh3D<MemorySpace> intersect_meshes(const OrderedMesh3D<MemorySpace>& A,
+                                            const Mesh3D<MemorySpace>& B) {
+  return intersect_meshes(typename MemorySpace::execution_space(), A, B);
+}
+
+} // namespace subsetix::intersection::v1
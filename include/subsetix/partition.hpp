@@ -0,0 +1,315 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/detail/utils.hpp>
+#include <subsetix/detail/sfc.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Sort.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace subsetix {
+
+/**
+ * @brief Balanced split of the rows of a mesh into contiguous curve ranges.
+ *
+ * Rows are ordered along a space-filling curve of (y, z); part p owns rows
+ * order[part_ptr[p] .. part_ptr[p+1]). Rows are never split, so a part can
+ * exceed the average by at most the weight of its heaviest row.
+ */
+template <class MemorySpace>
+struct MeshPartition {
+  using IndexView = Kokkos::View<std::size_t*, MemorySpace>;
+
+  IndexView order;                      // [num_rows] - row indices in curve order
+  std::vector<std::size_t> part_ptr;    // [num_parts + 1] - ranges into order
+  std::vector<std::size_t> part_cells;  // [num_parts] - cells owned by each part
+
+  std::size_t num_parts() const { return part_cells.size(); }
+};
+
+/**
+ * @brief Build the sub-mesh made of a subset of rows.
+ *
+ * @param exec Execution space instance the copy is enqueued on
+ * @param mesh Source mesh
+ * @param rows Row indices of mesh; the output stores rows in this order, so
+ *             only an ascending list yields a canonical (sorted) mesh
+ * @return Mesh with exactly those rows and their intervals
+ */
+template <class ExecSpace, class MemorySpace>
+Mesh3D<MemorySpace> extract_rows(const ExecSpace& exec,
+                                 const Mesh3D<MemorySpace>& mesh,
+                                 const Kokkos::View<std::size_t*, MemorySpace>& rows) {
+  using MeshType = Mesh3D<MemorySpace>;
+
+  const std::size_t m = rows.extent(0);
+  if (m == 0) {
+    return MeshType{};
+  }
+
+  auto src_keys = mesh.row_keys;
+  auto src_ptr = mesh.row_ptr;
+  auto src_intervals = mesh.intervals;
+
+  MeshType out;
+  out.num_rows = m;
+  out.row_keys = typename MeshType::RowKeyView(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "mesh_row_keys"), m);
+  out.row_ptr = typename MeshType::IndexView(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "mesh_row_ptr"), m + 1);
+
+  Kokkos::View<std::size_t*, MemorySpace> counts(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "extract_row_counts"), m);
+  auto out_keys = out.row_keys;
+  Kokkos::parallel_for(
+      "extract_rows_count",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, m),
+      KOKKOS_LAMBDA(const std::size_t i) {
+        const std::size_t r = rows(i);
+        out_keys(i) = src_keys(r);
+        counts(i) = src_ptr(r + 1) - src_ptr(r);
+      });
+
+  out.num_intervals = detail::exclusive_scan_csr_row_ptr<std::size_t>(
+      exec, "extract_rows_scan", m, counts, out.row_ptr);
+  out.intervals = typename MeshType::IntervalView(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "mesh_intervals"), out.num_intervals);
+
+  auto out_ptr = out.row_ptr;
+  auto out_intervals = out.intervals;
+  Kokkos::parallel_for(
+      "extract_rows_copy",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, m),
+      KOKKOS_LAMBDA(const std::size_t i) {
+        const std::size_t r = rows(i);
+        const std::size_t begin = src_ptr(r);
+        const std::size_t dst = out_ptr(i);
+        for (std::size_t k = 0; k < counts(i); ++k) {
+          out_intervals(dst + k) = src_intervals(begin + k);
+        }
+      });
+
+  return out;
+}
+
+/**
+ * @brief Build the sub-mesh made of a subset of rows (default instance of the mesh space).
+ */
+template <class MemorySpace>
+Mesh3D<MemorySpace> extract_rows(const Mesh3D<MemorySpace>& mesh,
+                                 const Kokkos::View<std::size_t*, MemorySpace>& rows) {
+  return extract_rows(typename MemorySpace::execution_space(), mesh, rows);
+}
+
+namespace detail {
+
+/**
+ * @brief Smallest (y, z) of a non-empty canonical mesh, used to anchor curve keys.
+ *
+ * Rows are sorted by y, so y_min is the first row; z_min needs a reduction.
+ */
+template <class ExecSpace, class MemorySpace>
+RowKey curve_anchor(const ExecSpace& exec, const Mesh3D<MemorySpace>& mesh) {
+  auto rows = mesh.row_keys;
+  RowKey first_row;
+  Kokkos::deep_copy(exec, first_row, Kokkos::subview(rows, 0));
+  Coord z_min = 0;
+  Kokkos::parallel_reduce(
+      "partition_z_min",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, mesh.num_rows),
+      KOKKOS_LAMBDA(const std::size_t i, Coord& local_min) {
+        if (rows(i).z < local_min) {
+          local_min = rows(i).z;
+        }
+      },
+      Kokkos::Min<Coord>(z_min));
+  exec.fence("partition_z_min");
+
+  return RowKey{first_row.y, z_min};
+}
+
+} // namespace detail
+
+/**
+ * @brief Partition the rows of a mesh into num_parts balanced parts.
+ *
+ * Algorithm:
+ * 1. Curve keys - Morton or Hilbert index of (y, z), shifted to the domain minimum
+ * 2. Sort - order rows by curve key
+ * 3. Weights - cells per row (sum of interval lengths), in curve order
+ * 4. Scan - weighted prefix sum along the curve
+ * 5. Split - part boundaries at the prefix entries nearest to p * total / num_parts
+ *
+ * @param exec Execution space instance the operation is enqueued on
+ * @param mesh Input mesh
+ * @param num_parts Number of parts (> 0)
+ * @param curve Space-filling curve used to order rows
+ * @throws std::invalid_argument if num_parts == 0
+ */
+template <class ExecSpace, class MemorySpace>
+MeshPartition<MemorySpace> partition(const ExecSpace& exec,
+                                     const Mesh3D<MemorySpace>& mesh,
+                                     std::size_t num_parts,
+                                     CurveType curve = CurveType::Hilbert) {
+  using IndexView = Kokkos::View<std::size_t*, MemorySpace>;
+  static_assert(Kokkos::SpaceAccessibility<ExecSpace, MemorySpace>::accessible,
+                "partition: execution space cannot access the mesh memory space");
+
+  if (num_parts == 0) {
+    throw std::invalid_argument("subsetix::partition: num_parts must be positive");
+  }
+
+  const std::size_t n = mesh.num_rows;
+  MeshPartition<MemorySpace> out;
+  out.order = IndexView(Kokkos::view_alloc(exec, "partition_order"), n);
+  out.part_ptr.assign(num_parts + 1, n);
+  out.part_ptr[0] = 0;
+  out.part_cells.assign(num_parts, 0);
+  if (n == 0) {
+    return out;
+  }
+
+  auto rows = mesh.row_keys;
+  auto row_ptr = mesh.row_ptr;
+  auto intervals = mesh.intervals;
+  auto order = out.order;
+
+  // Phase 1: Curve keys
+  const RowKey anchor = detail::curve_anchor(exec, mesh);
+  const Coord y_min = anchor.y;
+  const Coord z_min = anchor.z;
+
+  Kokkos::View<std::uint64_t*, MemorySpace> keys(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "partition_keys"), n);
+  Kokkos::parallel_for(
+      "partition_curve_keys",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, n),
+      KOKKOS_LAMBDA(const std::size_t i) {
+        const RowKey key = rows(i);
+        keys(i) = detail::row_curve_key(curve, key.y, key.z, y_min, z_min);
+        order(i) = i;
+      });
+
+  // Phase 2: Sort rows along the curve
+  Kokkos::Experimental::sort_by_key(exec, keys, order);
+
+  // Phase 3: Row weights in curve order
+  IndexView weights(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "partition_weights"),
+                    n);
+  Kokkos::parallel_for(
+      "partition_weights",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, n),
+      KOKKOS_LAMBDA(const std::size_t i) {
+        const std::size_t r = order(i);
+        std::size_t cells = 0;
+        for (std::size_t k = row_ptr(r); k < row_ptr(r + 1); ++k) {
+          cells += static_cast<std::size_t>(intervals(k).size());
+        }
+        weights(i) = cells;
+      });
+
+  // Phase 4: Weighted prefix sum
+  IndexView prefix(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "partition_prefix"),
+                   n + 1);
+  const std::size_t total = detail::exclusive_scan_csr_row_ptr<std::size_t>(
+      exec, "partition_prefix", n, weights, prefix);
+
+  // Phase 5: Split at the prefix entry nearest to each target weight
+  IndexView bounds(Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "partition_bounds"),
+                   num_parts + 1);
+  IndexView bound_cells(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "partition_bound_cells"),
+      num_parts + 1);
+  Kokkos::parallel_for(
+      "partition_bounds",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, num_parts + 1),
+      KOKKOS_LAMBDA(const std::size_t p) {
+        std::size_t b = n;
+        if (p < num_parts) {
+          const std::size_t target = static_cast<std::size_t>(
+              static_cast<double>(total) * static_cast<double>(p) /
+              static_cast<double>(num_parts));
+          std::size_t lo = 0;
+          std::size_t hi = n;
+          while (lo < hi) {
+            const std::size_t mid = lo + (hi - lo) / 2;
+            if (prefix(mid) < target) {
+              lo = mid + 1;
+            } else {
+              hi = mid;
+            }
+          }
+          if (lo > 0 && target - prefix(lo - 1) < prefix(lo) - target) {
+            --lo;
+          }
+          b = lo;
+        }
+        bounds(p) = b;
+        bound_cells(p) = prefix(b);
+      });
+
+  auto bounds_host = Kokkos::create_mirror_view(bounds);
+  auto bound_cells_host = Kokkos::create_mirror_view(bound_cells);
+  Kokkos::deep_copy(exec, bounds_host, bounds);
+  Kokkos::deep_copy(exec, bound_cells_host, bound_cells);
+  exec.fence("partition_bounds");
+  for (std::size_t p = 0; p < num_parts; ++p) {
+    out.part_ptr[p] = bounds_host(p);
+    out.part_cells[p] = bound_cells_host(p + 1) - bound_cells_host(p);
+  }
+  out.part_ptr[num_parts] = n;
+
+  return out;
+}
+
+/**
+ * @brief Partition the rows of a mesh on the default instance of the mesh space.
+ */
+template <class MemorySpace>
+MeshPartition<MemorySpace> partition(const Mesh3D<MemorySpace>& mesh,
+                                     std::size_t num_parts,
+                                     CurveType curve = CurveType::Hilbert) {
+  return partition(typename MemorySpace::execution_space(), mesh, num_parts, curve);
+}
+
+/**
+ * @brief Build the mesh owned by part p of a partition.
+ *
+ * Rows are restored to canonical (y, z) order so the result is a valid Mesh3D.
+ *
+ * @param exec Execution space instance the operation is enqueued on
+ */
+template <class ExecSpace, class MemorySpace>
+Mesh3D<MemorySpace> extract_part(const ExecSpace& exec,
+                                 const Mesh3D<MemorySpace>& mesh,
+                                 const MeshPartition<MemorySpace>& part,
+                                 std::size_t p) {
+  const std::size_t begin = part.part_ptr.at(p);
+  const std::size_t end = part.part_ptr.at(p + 1);
+
+  Kokkos::View<std::size_t*, MemorySpace> rows(
+      Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "part_rows"), end - begin);
+  Kokkos::deep_copy(exec, rows, Kokkos::subview(part.order, std::make_pair(begin, end)));
+  Kokkos::sort(exec, rows);
+
+  return extract_rows(exec, mesh, rows);
+}
+
+/**
+ * @brief Build the mesh owned by part p on the default instance of the mesh space.
+ */
+template <class MemorySpace>
+Mesh3D<MemorySpace> extract_part(const Mesh3D<MemorySpace>& mesh,
+                                 const MeshPartition<MemorySpace>& part,
+                                 std::size_t p) {
+  return extract_part(typename MemorySpace::execution_space(), mesh, part, p);
+}
+
+} // namespace subsetix
@@ -0,0 +1,456 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <Kokkos_Core.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <map>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace subsetix::profiling {
+
+// Built-in phase collector, compiled in with -DSUBSETIX_ENABLE_PROFILING
+// (CMake option of the same name). Without it, phases are still visible to
+// external Kokkos tools as regions.
+#ifdef SUBSETIX_ENABLE_PROFILING
+inline constexpr bool collector_available = true;
+#else
+inline constexpr bool collector_available = false;
+#endif
+
+/**
+ * @brief Accumulated cost of one phase (a region path such as
+ *        "intersect_meshes/count").
+ *
+ * Launches and bytes include those of nested phases.
+ */
+struct PhaseStats {
+  std::size_t calls = 0;
+  double seconds = 0.0;
+  std::size_t kernel_launches = 0;
+  std::size_t bytes_allocated = 0;
+};
+
+namespace detail {
+struct ToolCallbacks;
+} // namespace detail
+
+/**
+ * @brief Process-wide collector fed by Kokkos Tools callbacks.
+ *
+ * enable() installs push/pop region, parallel launch and allocation
+ * callbacks (replacing those of a tool loaded through KOKKOS_TOOLS_LIBS),
+ * so it must be called after Kokkos::initialize. While enabled,
+ * ScopedRegion fences its instance before closing so that phase times
+ * cover the kernels of the phase. Callbacks run on the launching host
+ * thread; the collector is not meant to be used from several host threads.
+ */
+class Collector {
+public:
+  static Collector& instance() {
+    static Collector collector;
+    return collector;
+  }
+
+  bool enabled() const { return enabled_; }
+
+  void enable();
+  void disable();
+
+  void reset() {
+    stats_.clear();
+    open_.clear();
+  }
+
+  const std::map<std::string, PhaseStats>& phases() const { return stats_; }
+
+  // Number of currently open regions (0 between operations)
+  std::size_t depth() const { return open_.size(); }
+
+  /**
+   * @brief Print one line per phase: calls, total and mean time, launches
+   *        and bytes allocated per call.
+   */
+  void report(std::ostream& os) const {
+    os << std::left << std::setw(40) << "phase" << std::right << std::setw(8) << "calls"
+       << std::setw(14) << "total [ms]" << std::setw(14) << "mean [ms]" << std::setw(12)
+       << "launches" << std::setw(14) << "bytes" << '\n';
+    for (const auto& [path, s] : stats_) {
+      const double calls = static_cast<double>(s.calls > 0 ? s.calls : 1);
+      os << std::left << std::setw(40) << path << std::right << std::setw(8) << s.calls
+         << std::fixed << std::setprecision(3) << std::setw(14) << 1e3 * s.seconds
+         << std::setw(14) << 1e3 * s.seconds / calls << std::setprecision(1) << std::setw(12)
+         << static_cast<double>(s.kernel_launches) / calls << std::setprecision(0)
+         << std::setw(14) << static_cast<double>(s.bytes_allocated) / calls << '\n';
+    }
+  }
+
+private:
+  friend struct detail::ToolCallbacks;
+  using Clock = std::chrono::steady_clock;
+
+  struct OpenRegion {
+    std::string path;
+    Clock::time_point start;
+    std::size_t launches = 0;
+    std::size_t bytes = 0;
+  };
+
+  void on_push(const char* name) {
+    std::string path = open_.empty() ? std::string(name) : open_.back().path + "/" + name;
+    open_.push_back({std::move(path), Clock::now(), 0, 0});
+  }
+
+  void on_pop() {
+    if (open_.empty()) {
+      return;
+    }
+    const OpenRegion r = open_.back();
+    open_.pop_back();
+    PhaseStats& s = stats_[r.path];
+    ++s.calls;
+    s.seconds += std::chrono::duration<double>(Clock::now() - r.start).count();
+    s.kernel_launches += r.launches;
+    s.bytes_allocated += r.bytes;
+  }
+
+  void on_launch() {
+    for (OpenRegion& r : open_) {
+      ++r.launches;
+    }
+  }
+
+  void on_allocate(const std::uint64_t size) {
+    for (OpenRegion& r : open_) {
+      r.bytes += static_cast<std::size_t>(size);
+    }
+  }
+
+  bool enabled_ = false;
+  std::vector<OpenRegion> open_;
+  std::map<std::string, PhaseStats> stats_;
+};
+
+/**
+ * @brief One View allocation seen by the AllocationTracker.
+ */
+struct AllocationRecord {
+  std::string label;
+  std::string operation;           // outermost open region, empty outside operations
+  std::size_t bytes = 0;
+  double lifetime_seconds = -1.0;  // negative while the allocation is live
+};
+
+/**
+ * @brief Memory footprint of one operation (an outermost region such as
+ *        "intersect_meshes").
+ *
+ * peak_bytes is the largest increase of live tracked bytes over the level
+ * at entry, across all calls; it includes the returned result.
+ */
+struct OperationMemory {
+  std::size_t calls = 0;
+  std::size_t peak_bytes = 0;
+  std::size_t allocations = 0;
+  std::size_t bytes_allocated = 0;
+};
+
+/**
+ * @brief Opt-in tracker of View allocations and live-byte high-water marks.
+ *
+ * Unlike the Collector, the tracker is always compiled in and adds no
+ * synchronisation: it only listens to allocation, deallocation and region
+ * callbacks, so it can be switched on around a single call in production
+ * builds. It shares the Kokkos Tools callbacks with the Collector and has
+ * the same restrictions (after Kokkos::initialize, one host thread).
+ * Memory allocated before enable() is not counted, and its deallocation is
+ * ignored.
+ */
+class AllocationTracker {
+public:
+  static AllocationTracker& instance() {
+    static AllocationTracker tracker;
+    return tracker;
+  }
+
+  bool enabled() const { return enabled_; }
+
+  // With keep_records=false only the per-operation totals are kept, which
+  // bounds the tracker's own memory over long runs
+  void enable(bool keep_records = true);
+  void disable();
+
+  void reset() {
+    records_.clear();
+    operations_.clear();
+    live_.clear();
+    current_bytes_ = 0;
+    peak_bytes_ = 0;
+    depth_ = 0;
+  }
+
+  // Live tracked bytes and their high-water mark since reset()
+  std::size_t current_bytes() const { return current_bytes_; }
+  std::size_t peak_bytes() const { return peak_bytes_; }
+
+  const std::vector<AllocationRecord>& allocations() const { return records_; }
+  const std::map<std::string, OperationMemory>& operations() const { return operations_; }
+
+  // Largest per-call peak over all operations (0 if none ran)
+  std::size_t max_operation_peak() const {
+    std::size_t peak = 0;
+    for (const auto& [name, m] : operations_) {
+      peak = (m.peak_bytes > peak) ? m.peak_bytes : peak;
+    }
+    return peak;
+  }
+
+  /**
+   * @brief Print one line per operation: calls, peak bytes, allocations and
+   *        bytes allocated per call.
+   */
+  void report(std::ostream& os) const {
+    os << std::left << std::setw(40) << "operation" << std::right << std::setw(8) << "calls"
+       << std::setw(16) << "peak bytes" << std::setw(12) << "allocs" << std::setw(16)
+       << "bytes" << '\n';
+    for (const auto& [name, m] : operations_) {
+      const double calls = static_cast<double>(m.calls > 0 ? m.calls : 1);
+      os << std::left << std::setw(40) << name << std::right << std::setw(8) << m.calls
+         << std::setw(16) << m.peak_bytes << std::fixed << std::setprecision(1)
+         << std::setw(12) << static_cast<double>(m.allocations) / calls
+         << std::setprecision(0) << std::setw(16)
+         << static_cast<double>(m.bytes_allocated) / calls << '\n';
+    }
+  }
+
+private:
+  friend struct detail::ToolCallbacks;
+  using Clock = std::chrono::steady_clock;
+
+  static constexpr std::size_t no_record = static_cast<std::size_t>(-1);
+
+  struct LiveAllocation {
+    std::size_t bytes = 0;
+    std::size_t record = no_record;
+    Clock::time_point start;
+  };
+
+  void on_push(const char* name) {
+    if (depth_++ == 0) {
+      operation_ = name;
+      operation_base_ = current_bytes_;
+      operation_peak_ = current_bytes_;
+      operation_allocations_ = 0;
+      operation_bytes_ = 0;
+    }
+  }
+
+  void on_pop() {
+    if (depth_ == 0 || --depth_ > 0) {
+      return;
+    }
+    OperationMemory& m = operations_[operation_];
+    ++m.calls;
+    const std::size_t peak = operation_peak_ - operation_base_;
+    m.peak_bytes = (peak > m.peak_bytes) ? peak : m.peak_bytes;
+    m.allocations += operation_allocations_;
+    m.bytes_allocated += operation_bytes_;
+  }
+
+  void on_allocate(const char* label, const void* ptr, const std::uint64_t size) {
+    const auto bytes = static_cast<std::size_t>(size);
+    LiveAllocation live{bytes, no_record, Clock::now()};
+    if (keep_records_) {
+      live.record = records_.size();
+      records_.push_back({label, depth_ > 0 ? operation_ : std::string(), bytes, -1.0});
+    }
+    live_[ptr] = live;
+    current_bytes_ += bytes;
+    peak_bytes_ = (current_bytes_ > peak_bytes_) ? current_bytes_ : peak_bytes_;
+    if (depth_ > 0) {
+      ++operation_allocations_;
+      operation_bytes_ += bytes;
+      operation_peak_ = (current_bytes_ > operation_peak_) ? current_bytes_ : operation_peak_;
+    }
+  }
+
+  void on_deallocate(const void* ptr) {
+    const auto it = live_.find(ptr);
+    if (it == live_.end()) {
+      return;
+    }
+    if (it->second.record != no_record) {
+      records_[it->second.record].lifetime_seconds =
+          std::chrono::duration<double>(Clock::now() - it->second.start).count();
+    }
+    current_bytes_ -= it->second.bytes;
+    // The operation's entry level is the floor: freeing older memory must
+    // not make later allocations look cheaper
+    if (depth_ > 0 && current_bytes_ < operation_base_) {
+      operation_peak_ -= operation_base_ - current_bytes_;
+      operation_base_ = current_bytes_;
+    }
+    live_.erase(it);
+  }
+
+  bool enabled_ = false;
+  bool keep_records_ = true;
+  std::vector<AllocationRecord> records_;
+  std::map<std::string, OperationMemory> operations_;
+  std::unordered_map<const void*, LiveAllocation> live_;
+  std::size_t current_bytes_ = 0;
+  std::size_t peak_bytes_ = 0;
+  std::size_t depth_ = 0;
+  std::string operation_;
+  std::size_t operation_base_ = 0;
+  std::size_t operation_peak_ = 0;
+  std::size_t operation_allocations_ = 0;
+  std::size_t operation_bytes_ = 0;
+};
+
+namespace detail {
+
+// Kokkos Tools holds a single callback per event, so the Collector and the
+// AllocationTracker share one set that forwards to whichever is enabled
+struct ToolCallbacks {
+  static void push(const char* name) {
+    if (Collector::instance().enabled()) {
+      Collector::instance().on_push(name);
+    }
+    if (AllocationTracker::instance().enabled()) {
+      AllocationTracker::instance().on_push(name);
+    }
+  }
+
+  static void pop() {
+    if (Collector::instance().enabled()) {
+      Collector::instance().on_pop();
+    }
+    if (AllocationTracker::instance().enabled()) {
+      AllocationTracker::instance().on_pop();
+    }
+  }
+
+  static void launch(const char*, const std::uint32_t, std::uint64_t*) {
+    if (Collector::instance().enabled()) {
+      Collector::instance().on_launch();
+    }
+  }
+
+  static void allocate(const Kokkos::Profiling::SpaceHandle, const char* label, const void* ptr,
+                       const std::uint64_t size) {
+    if (Collector::instance().enabled()) {
+      Collector::instance().on_allocate(size);
+    }
+    if (AllocationTracker::instance().enabled()) {
+      AllocationTracker::instance().on_allocate(label, ptr, size);
+    }
+  }
+
+  static void deallocate(const Kokkos::Profiling::SpaceHandle, const char*, const void* ptr,
+                         const std::uint64_t) {
+    if (AllocationTracker::instance().enabled()) {
+      AllocationTracker::instance().on_deallocate(ptr);
+    }
+  }
+
+  static void install() {
+    namespace tools = Kokkos::Tools::Experimental;
+    tools::set_push_region_callback(&push);
+    tools::set_pop_region_callback(&pop);
+    tools::set_begin_parallel_for_callback(&launch);
+    tools::set_begin_parallel_reduce_callback(&launch);
+    tools::set_begin_parallel_scan_callback(&launch);
+    tools::set_allocate_data_callback(&allocate);
+    tools::set_deallocate_data_callback(&deallocate);
+  }
+
+  // Remove the callbacks once neither consumer is enabled
+  static void uninstall_if_unused() {
+    if (Collector::instance().enabled() || AllocationTracker::instance().enabled()) {
+      return;
+    }
+    namespace tools = Kokkos::Tools::Experimental;
+    tools::set_push_region_callback(nullptr);
+    tools::set_pop_region_callback(nullptr);
+    tools::set_begin_parallel_for_callback(nullptr);
+    tools::set_begin_parallel_reduce_callback(nullptr);
+    tools::set_begin_parallel_scan_callback(nullptr);
+    tools::set_allocate_data_callback(nullptr);
+    tools::set_deallocate_data_callback(nullptr);
+  }
+};
+
+} // namespace detail
+
+inline void Collector::enable() {
+  if constexpr (collector_available) {
+    detail::ToolCallbacks::install();
+    enabled_ = true;
+  }
+}
+
+inline void Collector::disable() {
+  if (!enabled_) {
+    return;
+  }
+  enabled_ = false;
+  open_.clear();
+  detail::ToolCallbacks::uninstall_if_unused();
+}
+
+inline void AllocationTracker::enable(const bool keep_records) {
+  detail::ToolCallbacks::install();
+  keep_records_ = keep_records;
+  enabled_ = true;
+}
+
+inline void AllocationTracker::disable() {
+  if (!enabled_) {
+    return;
+  }
+  enabled_ = false;
+  depth_ = 0;
+  detail::ToolCallbacks::uninstall_if_unused();
+}
+
+/**
+ * @brief Named phase of a set operation, as a Kokkos profiling region.
+ *
+ * The region is pushed on construction and popped on destruction, so early
+ * returns stay balanced. When the built-in collector is enabled, exec is
+ * fenced before the pop; otherwise no synchronisation is added.
+ */
+template <class ExecSpace>
+class ScopedRegion {
+public:
+  ScopedRegion(const ExecSpace& exec, const char* name) : exec_(exec), name_(name) {
+    Kokkos::Profiling::pushRegion(name);
+  }
+
+  ~ScopedRegion() {
+    if constexpr (collector_available) {
+      if (Collector::instance().enabled()) {
+        exec_.fence(name_);
+      }
+    }
+    Kokkos::Profiling::popRegion();
+  }
+
+  ScopedRegion(const ScopedRegion&) = delete;
+  ScopedRegion& operator=(const ScopedRegion&) = delete;
+
+private:
+  ExecSpace exec_;
+  const char* name_;
+};
+
+} // namespace subsetix::profiling
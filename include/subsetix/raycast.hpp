@@ -0,0 +1,403 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/profiling.hpp>
+#include <subsetix/detail/utils.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace subsetix {
+
+/**
+ * @brief Ray origin + t * direction, t in [0, t_max), in cell units.
+ *
+ * Cell (x, y, z) covers [x, x + 1) x [y, y + 1) x [z, z + 1). The direction
+ * need not be normalised: t is measured in multiples of it.
+ */
+struct Ray {
+  double origin[3] = {0.0, 0.0, 0.0};
+  double direction[3] = {1.0, 0.0, 0.0};
+  double t_max = std::numeric_limits<double>::infinity();
+};
+
+/**
+ * @brief First cell of a mesh crossed by a ray.
+ *
+ * A ray that only grazes a cell (along an edge or through a corner) does not
+ * hit it. A ray starting inside the mesh hits its origin cell at t = 0.
+ */
+struct RayHit {
+  bool hit = false;
+  Coord cell[3] = {0, 0, 0};
+  double t = 0.0;            // entry parameter of the ray into cell
+  std::size_t interval = 0;  // interval of the mesh holding cell
+};
+
+namespace detail {
+
+// ============================================================================
+// Ray marching over the rows of a mesh
+// ============================================================================
+
+// Cell along one axis that a ray at position p enters when moving with d > 0
+// (floor) or d < 0 (the cell below p, also when p lies on a cell boundary)
+KOKKOS_INLINE_FUNCTION
+double ray_entry_cell(double p, double d) {
+  return (d < 0.0) ? Kokkos::ceil(p) - 1.0 : Kokkos::floor(p);
+}
+
+// Last cell a ray moving with d reaches at position p, without the cell it
+// would only touch at p
+KOKKOS_INLINE_FUNCTION
+double ray_exit_cell(double p, double d) {
+  return (d < 0.0) ? Kokkos::floor(p) : Kokkos::ceil(p) - 1.0;
+}
+
+// Parameter at which a ray leaves cell c of one axis. Computed from the ray
+// rather than accumulated, so that lattice-aligned corners compare equal
+KOKKOS_INLINE_FUNCTION
+double ray_crossing(std::int64_t c, double o, double d) {
+  return (d == 0.0) ? std::numeric_limits<double>::infinity()
+                    : (static_cast<double>(c + (d > 0.0 ? 1 : 0)) - o) / d;
+}
+
+KOKKOS_INLINE_FUNCTION
+std::int64_t clamp_to_coord(double c) {
+  const double lo = static_cast<double>(std::numeric_limits<Coord>::min());
+  const double hi = static_cast<double>(std::numeric_limits<Coord>::max());
+  return static_cast<std::int64_t>((c < lo) ? lo : (c > hi) ? hi : c);
+}
+
+template <class MemorySpace>
+struct RayMarcher {
+  Mesh3D<MemorySpace> mesh;
+  // Cell bounds of the rows, [y_lo, y_hi] x [z_lo, z_hi]
+  Coord y_lo = 0;
+  Coord y_hi = 0;
+  Coord z_lo = 0;
+  Coord z_hi = 0;
+
+  /**
+   * @brief First cell of row r crossed by the ray for t in [ta, tb).
+   *
+   * Direct interval search: the x cells the ray spans in the row form one
+   * range, and a binary search finds the first interval meeting it in the
+   * direction of travel.
+   */
+  KOKKOS_INLINE_FUNCTION
+  bool hit_in_row(std::size_t r, const Ray& ray, double ta, double tb, RayHit& out) const {
+    const double ox = ray.origin[0];
+    const double dx = ray.direction[0];
+    std::int64_t xa = 0;
+    std::int64_t xb = 0;
+    if (dx == 0.0) {
+      xa = xb = clamp_to_coord(Kokkos::floor(ox));
+    } else {
+      xa = clamp_to_coord(ray_entry_cell(ox + dx * ta, dx));
+      xb = clamp_to_coord((tb == std::numeric_limits<double>::infinity())
+                              ? ((dx > 0.0) ? std::numeric_limits<double>::max()
+                                            : std::numeric_limits<double>::lowest())
+                              : ray_exit_cell(ox + dx * tb, dx));
+    }
+
+    const std::size_t begin = mesh.row_ptr(r);
+    const std::size_t end = mesh.row_ptr(r + 1);
+    std::int64_t c = 0;
+    std::size_t k = 0;
+    if (dx >= 0.0) {
+      if (xa > xb) {
+        return false;
+      }
+      // First interval ending after xa
+      std::size_t lo = begin;
+      std::size_t hi = end;
+      while (lo < hi) {
+        const std::size_t mid = lo + (hi - lo) / 2;
+        if (mesh.intervals(mid).end <= xa) {
+          lo = mid + 1;
+        } else {
+          hi = mid;
+        }
+      }
+      if (lo == end) {
+        return false;
+      }
+      k = lo;
+      c = (mesh.intervals(k).begin > xa) ? mesh.intervals(k).begin : xa;
+      if (c > xb) {
+        return false;
+      }
+      out.t = (c > xa) ? (static_cast<double>(c) - ox) / dx : ta;
+    } else {
+      if (xa < xb) {
+        return false;
+      }
+      // Last interval beginning at or before xa
+      std::size_t lo = begin;
+      std::size_t hi = end;
+      while (lo < hi) {
+        const std::size_t mid = lo + (hi - lo) / 2;
+        if (mesh.intervals(mid).begin <= xa) {
+          lo = mid + 1;
+        } else {
+          hi = mid;
+        }
+      }
+      if (lo == begin) {
+        return false;
+      }
+      k = lo - 1;
+      const std::int64_t last = static_cast<std::int64_t>(mesh.intervals(k).end) - 1;
+      c = (last < xa) ? last : xa;
+      if (c < xb) {
+        return false;
+      }
+      out.t = (c < xa) ? (static_cast<double>(c + 1) - ox) / dx : ta;
+    }
+    out.hit = true;
+    out.cell[0] = static_cast<Coord>(c);
+    out.interval = k;
+    return true;
+  }
+
+  // Entry and exit of the ray into the slab [lo, hi + 1) of one axis
+  KOKKOS_INLINE_FUNCTION
+  static bool clip_slab(double o, double d, Coord lo, Coord hi, double& t0, double& t1) {
+    const double a = static_cast<double>(lo);
+    const double b = static_cast<double>(hi) + 1.0;
+    if (d == 0.0) {
+      return o >= a && o < b;
+    }
+    double ta = (a - o) / d;
+    double tb = (b - o) / d;
+    if (ta > tb) {
+      const double t = ta;
+      ta = tb;
+      tb = t;
+    }
+    t0 = (ta > t0) ? ta : t0;
+    t1 = (tb < t1) ? tb : t1;
+    return t0 < t1;
+  }
+
+  /**
+   * @brief Trace one ray: a 2D DDA over the (y, z) columns it crosses, with
+   *        a direct interval search in every column that holds a row.
+   *
+   * The ray is first clipped to the (y, z) bounds of the rows. An x-aligned
+   * ray stays in one column, so it is a single row lookup. Otherwise a y
+   * plane without any row is crossed in one step, whatever the number of z
+   * columns the ray spans in it, and inside a plane the march jumps from a
+   * column to the next stored z in the direction of travel. Jumps land on
+   * the column and parameter the unit-step DDA would reach, so both agree
+   * on corner crossings.
+   */
+  KOKKOS_INLINE_FUNCTION
+  RayHit trace(const Ray& ray) const {
+    RayHit out;
+    if (mesh.num_rows == 0) {
+      return out;
+    }
+    const double oy = ray.origin[1];
+    const double oz = ray.origin[2];
+    const double dy = ray.direction[1];
+    const double dz = ray.direction[2];
+
+    double t = 0.0;
+    double t_end = ray.t_max;
+    if (!clip_slab(oy, dy, y_lo, y_hi, t, t_end) || !clip_slab(oz, dz, z_lo, z_hi, t, t_end)) {
+      return out;
+    }
+
+    if (dy == 0.0 && dz == 0.0) {
+      // x-aligned: the one column the ray stays in, clip_slab put it in bounds
+      const RowKey key{static_cast<Coord>(Kokkos::floor(oy)),
+                       static_cast<Coord>(Kokkos::floor(oz))};
+      const std::size_t row = lower_bound_row(mesh.row_keys, mesh.num_rows, key);
+      if (row < mesh.num_rows && mesh.row_keys(row) == key &&
+          hit_in_row(row, ray, t, t_end, out)) {
+        out.cell[1] = key.y;
+        out.cell[2] = key.z;
+      }
+      return out;
+    }
+
+    const std::int64_t step_y = (dy > 0.0) ? 1 : -1;
+    const std::int64_t step_z = (dz > 0.0) ? 1 : -1;
+
+    // Cells at the slab entry, clamped against rounding of the entry point
+    std::int64_t cy = static_cast<std::int64_t>(ray_entry_cell(oy + dy * t, dy));
+    std::int64_t cz = static_cast<std::int64_t>(ray_entry_cell(oz + dz * t, dz));
+    cy = (cy < y_lo) ? y_lo : (cy > y_hi) ? y_hi : cy;
+    cz = (cz < z_lo) ? z_lo : (cz > z_hi) ? z_hi : cz;
+    double next_y = ray_crossing(cy, oy, dy);
+    double next_z = ray_crossing(cz, oz, dz);
+
+    while (t < t_end && cy >= y_lo && cy <= y_hi) {
+      // Rows of plane y = cy
+      const std::size_t plane_begin = lower_bound_row(
+          mesh.row_keys, mesh.num_rows,
+          RowKey{static_cast<Coord>(cy), std::numeric_limits<Coord>::min()});
+      const std::size_t plane_end = upper_bound_row(
+          mesh.row_keys, mesh.num_rows,
+          RowKey{static_cast<Coord>(cy), std::numeric_limits<Coord>::max()});
+
+      if (plane_begin == plane_end) {
+        // Empty plane: jump to the next y plane
+        if (next_y >= t_end) {
+          return out;
+        }
+        t = next_y;
+        cy += step_y;
+        next_y = ray_crossing(cy, oy, dy);
+        if (dz != 0.0) {
+          cz = static_cast<std::int64_t>(ray_entry_cell(oz + dz * t, dz));
+          cz = (cz < z_lo) ? z_lo : (cz > z_hi) ? z_hi : cz;
+          next_z = ray_crossing(cz, oz, dz);
+        }
+        continue;
+      }
+
+      // Columns of this plane until the ray leaves it
+      const double plane_exit = (next_y < t_end) ? next_y : t_end;
+      while (t < plane_exit && cz >= z_lo && cz <= z_hi) {
+        const double tb = (next_z < plane_exit) ? next_z : plane_exit;
+        // Row (cy, cz), searched within the plane only
+        std::size_t lo = plane_begin;
+        std::size_t hi = plane_end;
+        while (lo < hi) {
+          const std::size_t mid = lo + (hi - lo) / 2;
+          if (mesh.row_keys(mid).z < cz) {
+            lo = mid + 1;
+          } else {
+            hi = mid;
+          }
+        }
+        const bool has_row = lo < plane_end && mesh.row_keys(lo).z == cz;
+        if (has_row && tb > t && hit_in_row(lo, ray, t, tb, out)) {
+          out.cell[1] = static_cast<Coord>(cy);
+          out.cell[2] = static_cast<Coord>(cz);
+          return out;
+        }
+        if (next_z >= plane_exit) {
+          break;
+        }
+        // Next stored z of the plane in the direction of travel, or the
+        // first column past the z bounds when there is none
+        std::int64_t target = 0;
+        if (step_z > 0) {
+          const std::size_t next = has_row ? lo + 1 : lo;
+          target = (next < plane_end) ? mesh.row_keys(next).z : std::int64_t(z_hi) + 1;
+        } else {
+          target = (lo > plane_begin) ? mesh.row_keys(lo - 1).z : std::int64_t(z_lo) - 1;
+        }
+        if (ray_crossing(target - step_z, oz, dz) >= plane_exit) {
+          // Target not reached in this plane: go to the last column the ray
+          // enters before plane_exit
+          std::int64_t c = static_cast<std::int64_t>(ray_exit_cell(oz + dz * plane_exit, dz));
+          while ((c - target) * step_z >= 0 || ray_crossing(c - step_z, oz, dz) >= plane_exit) {
+            c -= step_z;
+          }
+          while (ray_crossing(c, oz, dz) < plane_exit) {
+            c += step_z;
+          }
+          target = c;
+        }
+        t = ray_crossing(target - step_z, oz, dz);
+        cz = target;
+        next_z = ray_crossing(cz, oz, dz);
+      }
+      if (plane_exit >= t_end || cz < z_lo || cz > z_hi) {
+        return out;
+      }
+      // A corner crossing steps both axes: the side columns are only grazed
+      if (next_z == next_y) {
+        cz += step_z;
+        next_z = ray_crossing(cz, oz, dz);
+      }
+      t = next_y;
+      cy += step_y;
+      next_y = ray_crossing(cy, oy, dy);
+    }
+    return out;
+  }
+};
+
+} // namespace detail
+
+// ============================================================================
+// Ray casting
+// ============================================================================
+
+/**
+ * @brief First hit cell of every ray of a batch.
+ *
+ * One thread per ray. x-aligned rays reduce to a single row lookup and a
+ * binary search of its intervals; other rays walk the (y, z) columns they
+ * cross with a 2D DDA clipped to the row bounds of the mesh, jumping over
+ * empty y planes and, within a plane, to the next stored z via the row key
+ * index (see detail::RayMarcher).
+ *
+ * @param exec Execution space instance the kernels are enqueued on
+ * @param mesh Mesh the rays are cast against
+ * @param rays Rays, in cell units
+ * @return hits(i) = first cell of mesh crossed by rays(i)
+ */
+template <class ExecSpace, class MemorySpace>
+Kokkos::View<RayHit*, MemorySpace> raycast(const ExecSpace& exec,
+                                           const Mesh3D<MemorySpace>& mesh,
+                                           const Kokkos::View<Ray*, MemorySpace>& rays) {
+  static_assert(Kokkos::SpaceAccessibility<ExecSpace, MemorySpace>::accessible,
+                "raycast: execution space cannot access the mesh memory space");
+
+  const profiling::ScopedRegion<ExecSpace> op_region(exec, "raycast");
+
+  const std::size_t n = rays.extent(0);
+  Kokkos::View<RayHit*, MemorySpace> hits(Kokkos::view_alloc(exec, "raycast_hits"), n);
+  if (n == 0 || mesh.num_rows == 0) {
+    return hits;
+  }
+
+  // Row bounds: y from the first and last keys, z by a reduction
+  detail::RayMarcher<MemorySpace> marcher{mesh};
+  RowKey first;
+  RowKey last;
+  Kokkos::deep_copy(exec, first, Kokkos::subview(mesh.row_keys, 0));
+  Kokkos::deep_copy(exec, last, Kokkos::subview(mesh.row_keys, mesh.num_rows - 1));
+  auto rows = mesh.row_keys;
+  Coord z_lo = 0;
+  Coord z_hi = 0;
+  Kokkos::parallel_reduce(
+      "raycast_z_bounds",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, mesh.num_rows),
+      KOKKOS_LAMBDA(const std::size_t i, Coord& lo, Coord& hi) {
+        lo = (rows(i).z < lo) ? rows(i).z : lo;
+        hi = (rows(i).z > hi) ? rows(i).z : hi;
+      },
+      Kokkos::Min<Coord>(z_lo), Kokkos::Max<Coord>(z_hi));
+  exec.fence("raycast_z_bounds");
+  marcher.y_lo = first.y;
+  marcher.y_hi = last.y;
+  marcher.z_lo = z_lo;
+  marcher.z_hi = z_hi;
+
+  Kokkos::parallel_for(
+      "raycast_trace",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, n),
+      KOKKOS_LAMBDA(const std::size_t i) { hits(i) = marcher.trace(rays(i)); });
+  return hits;
+}
+
+template <class MemorySpace>
+Kokkos::View<RayHit*, MemorySpace> raycast(const Mesh3D<MemorySpace>& mesh,
+                                           const Kokkos::View<Ray*, MemorySpace>& rays) {
+  return raycast(typename MemorySpace::execution_space(), mesh, rays);
+}
+
+} // namespace subsetix
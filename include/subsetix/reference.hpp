@@ -0,0 +1,510 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/intersection/v1.hpp>
+#include <subsetix/raycast.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace subsetix::reference {
+
+// ============================================================================
+// Host reference implementations of the set operations
+// ============================================================================
+//
+// Deliberately simple, sequential code on std containers: the ground truth
+// for differential tests of the Kokkos kernels and the baseline their
+// benchmarks are compared against. Not meant to be fast.
+
+// Canonical rows: sorted keys, each row non-empty with sorted, disjoint intervals
+using RowIntervals = std::vector<Interval>;
+using Rows = std::map<RowKey, RowIntervals>;
+
+/**
+ * @brief Host copy of a mesh as keyed rows.
+ */
+template <class MemorySpace>
+Rows to_rows(const Mesh3D<MemorySpace>& mesh) {
+  const Mesh3DHost h = intersection::v1::mesh_to<Kokkos::HostSpace>(mesh);
+  Rows rows;
+  for (std::size_t i = 0; i < h.num_rows; ++i) {
+    RowIntervals& row = rows[h.row_keys(i)];
+    for (std::size_t k = h.row_ptr(i); k < h.row_ptr(i + 1); ++k) {
+      row.push_back(h.intervals(k));
+    }
+  }
+  return rows;
+}
+
+/**
+ * @brief Mesh holding the given rows (empty rows are skipped).
+ */
+template <class MemorySpace = Kokkos::DefaultExecutionSpace::memory_space>
+Mesh3D<MemorySpace> to_mesh(const Rows& rows) {
+  std::size_t num_rows = 0;
+  std::size_t num_intervals = 0;
+  for (const auto& [key, row] : rows) {
+    num_rows += row.empty() ? 0 : 1;
+    num_intervals += row.size();
+  }
+  if (num_rows == 0) {
+    return Mesh3D<MemorySpace>{};
+  }
+
+  Mesh3DHost h;
+  h.row_keys = Mesh3DHost::RowKeyView("reference_row_keys", num_rows);
+  h.row_ptr = Mesh3DHost::IndexView("reference_row_ptr", num_rows + 1);
+  h.intervals = Mesh3DHost::IntervalView("reference_intervals", num_intervals);
+  h.num_rows = num_rows;
+  h.num_intervals = num_intervals;
+
+  std::size_t i = 0;
+  std::size_t k = 0;
+  for (const auto& [key, row] : rows) {
+    if (row.empty()) {
+      continue;
+    }
+    h.row_keys(i) = key;
+    h.row_ptr(i) = k;
+    for (const Interval& iv : row) {
+      h.intervals(k++) = iv;
+    }
+    ++i;
+  }
+  h.row_ptr(num_rows) = k;
+  return intersection::v1::mesh_to<MemorySpace>(h);
+}
+
+// ----------------------------------------------------------------------------
+// Row operations (std::set_intersection-style merges of sorted intervals)
+// ----------------------------------------------------------------------------
+
+inline RowIntervals intersect_row(const RowIntervals& a, const RowIntervals& b) {
+  RowIntervals out;
+  auto ia = a.begin();
+  auto ib = b.begin();
+  while (ia != a.end() && ib != b.end()) {
+    const Coord begin = std::max(ia->begin, ib->begin);
+    const Coord end = std::min(ia->end, ib->end);
+    if (begin < end) {
+      out.push_back({begin, end});
+    }
+    if (ia->end < ib->end) {
+      ++ia;
+    } else if (ib->end < ia->end) {
+      ++ib;
+    } else {
+      ++ia;
+      ++ib;
+    }
+  }
+  return out;
+}
+
+// Touching intervals are merged
+inline RowIntervals unite_row(const RowIntervals& a, const RowIntervals& b) {
+  RowIntervals merged;
+  merged.reserve(a.size() + b.size());
+  std::merge(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(merged),
+             [](const Interval& x, const Interval& y) { return x.begin < y.begin; });
+  RowIntervals out;
+  for (const Interval& iv : merged) {
+    if (!out.empty() && iv.begin <= out.back().end) {
+      out.back().end = std::max(out.back().end, iv.end);
+    } else {
+      out.push_back(iv);
+    }
+  }
+  return out;
+}
+
+inline RowIntervals subtract_row(const RowIntervals& a, const RowIntervals& b) {
+  RowIntervals out;
+  auto ib = b.begin();
+  for (const Interval& iv : a) {
+    Coord begin = iv.begin;
+    while (ib != b.end() && ib->end <= begin) {
+      ++ib;
+    }
+    for (auto it = ib; it != b.end() && it->begin < iv.end; ++it) {
+      if (it->begin > begin) {
+        out.push_back({begin, it->begin});
+      }
+      begin = std::max(begin, it->end);
+    }
+    if (begin < iv.end) {
+      out.push_back({begin, iv.end});
+    }
+  }
+  return out;
+}
+
+// ----------------------------------------------------------------------------
+// Mesh operations
+// ----------------------------------------------------------------------------
+
+inline Rows intersect(const Rows& a, const Rows& b) {
+  Rows out;
+  for (const auto& [key, row] : a) {
+    const auto it = b.find(key);
+    if (it == b.end()) {
+      continue;
+    }
+    RowIntervals r = intersect_row(row, it->second);
+    if (!r.empty()) {
+      out.emplace(key, std::move(r));
+    }
+  }
+  return out;
+}
+
+inline Rows unite(const Rows& a, const Rows& b) {
+  Rows out = a;
+  for (const auto& [key, row] : b) {
+    RowIntervals& dst = out[key];
+    dst = unite_row(dst, row);
+  }
+  return out;
+}
+
+inline Rows subtract(const Rows& a, const Rows& b) {
+  Rows out;
+  for (const auto& [key, row] : a) {
+    const auto it = b.find(key);
+    RowIntervals r = (it == b.end()) ? row : subtract_row(row, it->second);
+    if (!r.empty()) {
+      out.emplace(key, std::move(r));
+    }
+  }
+  return out;
+}
+
+/**
+ * @brief Cells of box that are not in rows (rows outside the box are ignored).
+ */
+inline Rows complement(const Rows& rows, const CellBox& box) {
+  Rows out;
+  if (box.empty()) {
+    return out;
+  }
+  const RowIntervals full = {{box.lo[0], box.hi[0]}};
+  for (Coord y = box.lo[1]; y < box.hi[1]; ++y) {
+    for (Coord z = box.lo[2]; z < box.hi[2]; ++z) {
+      const auto it = rows.find(RowKey{y, z});
+      RowIntervals r = (it == rows.end()) ? full : subtract_row(full, it->second);
+      if (!r.empty()) {
+        out.emplace(RowKey{y, z}, std::move(r));
+      }
+    }
+  }
+  return out;
+}
+
+/**
+ * @brief Smallest box holding every cell of rows (empty box if none).
+ *
+ * Row keys must stay below INT32_MAX, whose exclusive bound is not representable.
+ */
+inline CellBox bounding_box(const Rows& rows) {
+  CellBox box;
+  bool first = true;
+  for (const auto& [key, row] : rows) {
+    if (row.empty()) {
+      continue;
+    }
+    const Coord lo[3] = {row.front().begin, key.y, key.z};
+    const Coord hi[3] = {row.back().end, key.y + 1, key.z + 1};
+    for (int a = 0; a < 3; ++a) {
+      box.lo[a] = first ? lo[a] : std::min(box.lo[a], lo[a]);
+      box.hi[a] = first ? hi[a] : std::max(box.hi[a], hi[a]);
+    }
+    first = false;
+  }
+  return box;
+}
+
+/**
+ * @brief Component label of every interval, in row then interval order.
+ *
+ * Two intervals are connected when some pair of their cells are neighbours
+ * under connectivity, i.e. when the number of axes on which the cells differ
+ * is at most 1 (Face), 2 (Edge) or 3 (Vertex). Labels are numbered by the
+ * first interval of each component, as label_components numbers them.
+ */
+inline std::vector<std::size_t> label_components(const Rows& rows, Connectivity connectivity) {
+  const int max_axes = (connectivity == Connectivity::Face)   ? 1
+                       : (connectivity == Connectivity::Edge) ? 2
+                                                              : 3;
+  // Index of the first interval of every row
+  std::map<RowKey, std::size_t> first;
+  std::size_t n = 0;
+  for (const auto& [key, row] : rows) {
+    first[key] = n;
+    n += row.size();
+  }
+
+  std::vector<std::size_t> parent(n);
+  for (std::size_t k = 0; k < n; ++k) {
+    parent[k] = k;
+  }
+  auto find = [&](std::size_t x) {
+    while (parent[x] != x) {
+      x = parent[x];
+    }
+    return x;
+  };
+
+  for (const auto& [key, row] : rows) {
+    for (int dy = -1; dy <= 1; ++dy) {
+      for (int dz = -1; dz <= 1; ++dz) {
+        const std::int64_t y = static_cast<std::int64_t>(key.y) + dy;
+        const std::int64_t z = static_cast<std::int64_t>(key.z) + dz;
+        if (y != static_cast<Coord>(y) || z != static_cast<Coord>(z)) {
+          continue;  // past the int32 range
+        }
+        const auto it = rows.find(RowKey{static_cast<Coord>(y), static_cast<Coord>(z)});
+        if (it == rows.end()) {
+          continue;
+        }
+        const int row_axes = (dy != 0) + (dz != 0);
+        for (std::size_t i = 0; i < row.size(); ++i) {
+          for (std::size_t j = 0; j < it->second.size(); ++j) {
+            const Coord lo = std::max(row[i].begin, it->second[j].begin);
+            const Coord hi = std::min(row[i].end, it->second[j].end);
+            // Overlapping x ranges share cells on x; touching ones are one cell apart
+            const int axes = (lo < hi) ? row_axes : (lo == hi) ? row_axes + 1 : 4;
+            if (axes <= max_axes) {
+              const std::size_t a = find(first[key] + i);
+              const std::size_t b = find(first[it->first] + j);
+              parent[std::max(a, b)] = std::min(a, b);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  // Roots are the smallest index of their component: number them in order
+  std::vector<std::size_t> labels(n);
+  std::size_t num_components = 0;
+  for (std::size_t k = 0; k < n; ++k) {
+    const std::size_t root = find(k);
+    labels[k] = (root == k) ? num_components++ : labels[root];
+  }
+  return labels;
+}
+
+/**
+ * @brief Cells of rows with a neighbour (under connectivity) outside rows.
+ *
+ * Computed as rows minus their erosion, the erosion intersecting every row
+ * with its neighbour rows shifted by each neighbour offset.
+ */
+inline Rows boundary(const Rows& rows, Connectivity connectivity) {
+  const int max_axes = (connectivity == Connectivity::Face)   ? 1
+                       : (connectivity == Connectivity::Edge) ? 2
+                                                              : 3;
+  Rows out;
+  for (const auto& [key, row] : rows) {
+    RowIntervals interior = row;
+    for (int dx = -1; dx <= 1; ++dx) {
+      for (int dy = -1; dy <= 1; ++dy) {
+        for (int dz = -1; dz <= 1; ++dz) {
+          const int axes = (dx != 0) + (dy != 0) + (dz != 0);
+          if (axes == 0 || axes > max_axes) {
+            continue;
+          }
+          const std::int64_t y = static_cast<std::int64_t>(key.y) + dy;
+          const std::int64_t z = static_cast<std::int64_t>(key.z) + dz;
+          const auto it = (y == static_cast<Coord>(y) && z == static_cast<Coord>(z))
+                              ? rows.find(RowKey{static_cast<Coord>(y), static_cast<Coord>(z)})
+                              : rows.end();
+          // x is interior only if x + dx is in the neighbour row
+          RowIntervals shifted;
+          if (it != rows.end()) {
+            for (const Interval& iv : it->second) {
+              const std::int64_t b = static_cast<std::int64_t>(iv.begin) - dx;
+              const std::int64_t e = static_cast<std::int64_t>(iv.end) - dx;
+              const Coord lo = static_cast<Coord>(std::max<std::int64_t>(b, row.front().begin));
+              const Coord hi = static_cast<Coord>(std::min<std::int64_t>(e, row.back().end));
+              if (lo < hi) {
+                shifted.push_back({lo, hi});
+              }
+            }
+          }
+          interior = intersect_row(interior, shifted);
+        }
+      }
+    }
+    RowIntervals r = subtract_row(row, interior);
+    if (!r.empty()) {
+      out.emplace(key, std::move(r));
+    }
+  }
+  return out;
+}
+
+/**
+ * @brief Whether cell (x, y, z) is in rows (false outside the Coord range).
+ */
+inline bool contains(const Rows& rows, std::int64_t x, std::int64_t y, std::int64_t z) {
+  if (y != static_cast<Coord>(y) || z != static_cast<Coord>(z)) {
+    return false;
+  }
+  const auto it = rows.find(RowKey{static_cast<Coord>(y), static_cast<Coord>(z)});
+  if (it == rows.end()) {
+    return false;
+  }
+  for (const Interval& iv : it->second) {
+    if (iv.begin <= x && x < iv.end) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Distance of every cell to the nearest cell outside rows, in cell
+ *        traversal order (row, interval, x).
+ *
+ * Brute force: Chebyshev shells of growing radius r around the cell are
+ * scanned until r^2 exceeds the best squared distance found.
+ */
+inline std::vector<double> distance_transform(const Rows& rows) {
+  std::vector<double> out;
+  for (const auto& [key, row] : rows) {
+    for (const Interval& iv : row) {
+      for (std::int64_t x = iv.begin; x < iv.end; ++x) {
+        std::int64_t best = std::numeric_limits<std::int64_t>::max();
+        for (std::int64_t r = 1; r * r < best; ++r) {
+          for (std::int64_t dx = -r; dx <= r; ++dx) {
+            for (std::int64_t dy = -r; dy <= r; ++dy) {
+              for (std::int64_t dz = -r; dz <= r; ++dz) {
+                const bool on_shell = std::max({std::abs(dx), std::abs(dy), std::abs(dz)}) == r;
+                if (on_shell && !contains(rows, x + dx, key.y + dy, key.z + dz)) {
+                  best = std::min(best, dx * dx + dy * dy + dz * dz);
+                }
+              }
+            }
+          }
+        }
+        out.push_back(std::sqrt(static_cast<double>(best)));
+      }
+    }
+  }
+  return out;
+}
+
+/**
+ * @brief Hausdorff distance along x between two non-empty rows, in cells.
+ *
+ * Brute force over every cell of each row.
+ */
+inline std::int64_t row_hausdorff(const RowIntervals& a, const RowIntervals& b) {
+  auto directed = [](const RowIntervals& p, const RowIntervals& q) {
+    std::int64_t result = 0;
+    for (const Interval& iv : p) {
+      for (std::int64_t x = iv.begin; x < iv.end; ++x) {
+        std::int64_t nearest = std::numeric_limits<std::int64_t>::max();
+        for (const Interval& jv : q) {
+          const std::int64_t d = (x < jv.begin) ? jv.begin - x : (x >= jv.end) ? x - jv.end + 1 : 0;
+          nearest = std::min(nearest, d);
+        }
+        result = std::max(result, nearest);
+      }
+    }
+    return result;
+  };
+  return std::max(directed(a, b), directed(b, a));
+}
+
+/**
+ * @brief First cell of rows crossed by a ray.
+ *
+ * Brute force: slab test of the ray against every cell; a cell counts only
+ * if the ray spends a positive length in it. interval is the position of
+ * the interval in the CSR layout of to_mesh(rows).
+ */
+inline RayHit raycast(const Rows& rows, const Ray& ray) {
+  RayHit best;
+  std::size_t k = 0;
+  for (const auto& [key, row] : rows) {
+    for (const Interval& iv : row) {
+      for (std::int64_t x = iv.begin; x < iv.end; ++x) {
+        const double lo[3] = {static_cast<double>(x), static_cast<double>(key.y),
+                              static_cast<double>(key.z)};
+        double enter = -std::numeric_limits<double>::infinity();
+        double leave = std::numeric_limits<double>::infinity();
+        bool inside = true;
+        for (int a = 0; a < 3; ++a) {
+          const double o = ray.origin[a];
+          const double d = ray.direction[a];
+          if (d == 0.0) {
+            inside = inside && o >= lo[a] && o < lo[a] + 1.0;
+            continue;
+          }
+          const double t0 = (lo[a] - o) / d;
+          const double t1 = (lo[a] + 1.0 - o) / d;
+          enter = std::max(enter, std::min(t0, t1));
+          leave = std::min(leave, std::max(t0, t1));
+        }
+        const double t = std::max(enter, 0.0);
+        if (!inside || !(enter < leave) || leave <= 0.0 || t >= ray.t_max) {
+          continue;
+        }
+        if (!best.hit || t < best.t) {
+          best.hit = true;
+          best.t = t;
+          best.cell[0] = static_cast<Coord>(x);
+          best.cell[1] = key.y;
+          best.cell[2] = key.z;
+          best.interval = k;
+        }
+      }
+      ++k;
+    }
+  }
+  return best;
+}
+
+inline std::int64_t count_cells(const Rows& rows) {
+  std::int64_t cells = 0;
+  for (const auto& [key, row] : rows) {
+    for (const Interval& iv : row) {
+      cells += static_cast<std::int64_t>(iv.end) - iv.begin;  // no int32 overflow
+    }
+  }
+  return cells;
+}
+
+inline bool same_rows(const Rows& a, const Rows& b) {
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (auto ia = a.begin(), ib = b.begin(); ia != a.end(); ++ia, ++ib) {
+    if (ia->first != ib->first || ia->second.size() != ib->second.size()) {
+      return false;
+    }
+    for (std::size_t k = 0; k < ia->second.size(); ++k) {
+      if (ia->second[k].begin != ib->second[k].begin || ia->second[k].end != ib->second[k].end) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+} // namespace subsetix::reference
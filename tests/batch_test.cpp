@@ -0,0 +1,108 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/batch.hpp>
+#include <subsetix/intersection/v1.hpp>
+#include <subsetix/intersection/batch.hpp>
+
+#include "test_utils/mesh_helpers.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using namespace subsetix;
+using subsetix::intersection::v1::intersect_batch;
+using subsetix::intersection::v1::intersect_meshes;
+using subsetix::test::expect_same_mesh;
+using subsetix::test::make_mesh_device;
+
+// ============================================================================
+// Test helpers
+// ============================================================================
+
+// Small random mesh: rows in [0, 4)^2, up to two intervals per row in [0, 16)
+Mesh3DDevice make_random_mesh(std::mt19937& rng) {
+  std::vector<RowKey> keys;
+  std::vector<std::size_t> ptr = {0};
+  std::vector<Interval> iv;
+  for (Coord y = 0; y < 4; ++y) {
+    for (Coord z = 0; z < 4; ++z) {
+      if (rng() % 2 == 0) {
+        continue;
+      }
+      const Coord b = static_cast<Coord>(rng() % 6);
+      iv.push_back({b, b + 1 + static_cast<Coord>(rng() % 4)});
+      if (rng() % 2 == 0) {
+        const Coord c = 10 + static_cast<Coord>(rng() % 3);
+        iv.push_back({c, c + 2});
+      }
+      keys.push_back({y, z});
+      ptr.push_back(iv.size());
+    }
+  }
+  return make_mesh_device(keys, ptr, iv);
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// Packing
+// ============================================================================
+
+TEST(BatchTest, MakeBatchRoundTrips) {
+  std::mt19937 rng(7);
+  std::vector<Mesh3DDevice> meshes = {make_random_mesh(rng), Mesh3DDevice{},
+                                      make_random_mesh(rng), make_random_mesh(rng)};
+  const MeshBatchDevice batch = make_batch(meshes);
+
+  ASSERT_EQ(batch.num_meshes, 4u);
+  for (std::size_t m = 0; m < meshes.size(); ++m) {
+    expect_same_mesh(unbatch(batch, m), meshes[m]);
+  }
+  EXPECT_THROW(unbatch(batch, 4), std::out_of_range);
+}
+
+// ============================================================================
+// Batched intersection
+// ============================================================================
+
+TEST(BatchTest, IntersectBatchMatchesPairwise) {
+  std::mt19937 rng(42);
+  std::vector<std::pair<Mesh3DDevice, Mesh3DDevice>> pairs;
+  for (int p = 0; p < 32; ++p) {
+    pairs.emplace_back(make_random_mesh(rng), make_random_mesh(rng));
+  }
+  // Empty sides and a pair without common rows
+  pairs.emplace_back(Mesh3DDevice{}, make_random_mesh(rng));
+  pairs.emplace_back(make_random_mesh(rng), Mesh3DDevice{});
+  pairs.emplace_back(make_mesh_device({{0, 0}}, {0, 1}, {{0, 4}}),
+                     make_mesh_device({{1, 0}}, {0, 1}, {{0, 4}}));
+
+  const MeshBatchDevice result = intersect_batch(pairs);
+  ASSERT_EQ(result.num_meshes, pairs.size());
+  for (std::size_t p = 0; p < pairs.size(); ++p) {
+    SCOPED_TRACE(p);
+    expect_same_mesh(unbatch(result, p), intersect_meshes(pairs[p].first, pairs[p].second));
+  }
+}
+
+TEST(BatchTest, EmptyBatch) {
+  const std::vector<std::pair<Mesh3DDevice, Mesh3DDevice>> pairs;
+  const MeshBatchDevice result = intersect_batch(pairs);
+  EXPECT_EQ(result.num_meshes, 0u);
+  EXPECT_EQ(result.num_rows, 0u);
+}
+
+TEST(BatchTest, MismatchedBatchesThrow) {
+  std::mt19937 rng(1);
+  const MeshBatchDevice a = make_batch(std::vector<Mesh3DDevice>{make_random_mesh(rng)});
+  const MeshBatchDevice b = make_batch(std::vector<Mesh3DDevice>{});
+  EXPECT_THROW(intersect_batch(a, b), std::invalid_argument);
+}
@@ -0,0 +1,109 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/boundary.hpp>
+#include <subsetix/reference.hpp>
+
+#include "test_utils/random_mesh.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+namespace {
+
+using namespace subsetix;
+namespace ref = subsetix::reference;
+using subsetix::test::block;
+
+ref::Rows device_boundary(const ref::Rows& rows, Connectivity c) {
+  return ref::to_rows(boundary(ref::to_mesh(rows), c));
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// Small hand-built cases
+// ============================================================================
+
+TEST(BoundaryTest, EmptyMesh) {
+  const Mesh3DDevice out = boundary(Mesh3DDevice{});
+  EXPECT_EQ(out.num_rows, 0u);
+  EXPECT_EQ(out.num_intervals, 0u);
+}
+
+TEST(BoundaryTest, BlockShell) {
+  const ref::Rows rows = block(4);
+  for (Connectivity c : {Connectivity::Face, Connectivity::Edge, Connectivity::Vertex}) {
+    const ref::Rows b = device_boundary(rows, c);
+    EXPECT_EQ(ref::count_cells(b), 64 - 8) << static_cast<int>(c);
+    EXPECT_EQ(b.size(), rows.size());  // every row keeps its end cells
+    EXPECT_TRUE(ref::same_rows(b, ref::subtract(rows, ref::Rows{{{1, 1}, {{1, 3}}},
+                                                                {{1, 2}, {{1, 3}}},
+                                                                {{2, 1}, {{1, 3}}},
+                                                                {{2, 2}, {{1, 3}}}})));
+  }
+}
+
+TEST(BoundaryTest, TouchingIntervalsFormOneRun) {
+  ref::Rows rows = block(3);
+  rows[{1, 1}] = {{0, 1}, {1, 3}};
+  rows[{0, 1}] = {{0, 2}, {2, 3}};
+  const ref::Rows b = device_boundary(rows, Connectivity::Face);
+  // The centre cell is interior; the split intervals of the centre row are kept apart
+  EXPECT_TRUE(ref::same_rows({{{1, 1}, b.at({1, 1})}}, {{{1, 1}, {{0, 1}, {2, 3}}}}));
+  EXPECT_EQ(ref::count_cells(b), 26);
+}
+
+TEST(BoundaryTest, ConnectivityReach) {
+  // 3 x 3 x 3 block without the corner (0, 0, 0): the corner only touches the
+  // centre (1, 1, 1) by a vertex
+  ref::Rows rows = block(3);
+  rows[{0, 0}] = {{1, 3}};
+  EXPECT_EQ(ref::count_cells(device_boundary(rows, Connectivity::Face)), 25);
+  EXPECT_EQ(ref::count_cells(device_boundary(rows, Connectivity::Edge)), 25);
+  EXPECT_EQ(ref::count_cells(device_boundary(rows, Connectivity::Vertex)), 26);
+
+  // Without the edge cell (0, 0, 1) instead, the centre has an edge neighbour out
+  rows = block(3);
+  rows[{0, 1}] = {{1, 3}};
+  EXPECT_EQ(ref::count_cells(device_boundary(rows, Connectivity::Face)), 25);
+  EXPECT_EQ(ref::count_cells(device_boundary(rows, Connectivity::Edge)), 26);
+}
+
+TEST(BoundaryTest, MissingNeighbourRow) {
+  // A single row has no neighbour rows at all: everything is boundary
+  const ref::Rows rows = {{{0, 0}, {{0, 10}, {20, 30}}}};
+  EXPECT_TRUE(ref::same_rows(device_boundary(rows, Connectivity::Face), rows));
+}
+
+// ============================================================================
+// Random meshes against the reference
+// ============================================================================
+
+TEST(BoundaryTest, MatchesReference) {
+  std::mt19937 rng(13);
+  std::vector<test::RandomMeshParams> windows = {test::params_small(), test::params_low_extreme(),
+                                                 test::params_high_extreme(),
+                                                 test::params_full_range()};
+  // Dense rows with short gaps, so that interiors are not empty
+  test::RandomMeshParams dense;
+  dense.row_span = 10;
+  dense.row_fill = 0.9;
+  dense.x_hi = 32;
+  dense.max_intervals = 3;
+  windows.push_back(dense);
+
+  for (const test::RandomMeshParams& p : windows) {
+    for (int trial = 0; trial < 10; ++trial) {
+      const ref::Rows rows = test::random_rows(rng, p);
+      for (Connectivity c : {Connectivity::Face, Connectivity::Edge, Connectivity::Vertex}) {
+        EXPECT_TRUE(ref::same_rows(device_boundary(rows, c), ref::boundary(rows, c)))
+            << "x in [" << p.x_lo << ", " << p.x_hi << "], trial " << trial
+            << ", connectivity " << static_cast<int>(c);
+      }
+    }
+  }
+}
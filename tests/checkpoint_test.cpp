@@ -0,0 +1,212 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/field.hpp>
+#include <subsetix/io/checkpoint.hpp>
+#include <subsetix/intersection/v1.hpp>
+
+#include "test_utils/mesh_helpers.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace subsetix;
+using subsetix::test::copy_to_view;
+using subsetix::test::expect_same_mesh;
+using subsetix::test::make_mesh_device;
+
+using DeviceSpace = Kokkos::DefaultExecutionSpace::memory_space;
+
+// ============================================================================
+// Test helpers
+// ============================================================================
+
+std::string temp_path(const std::string& name) {
+  return ::testing::TempDir() + name;
+}
+
+std::vector<Mesh3DDevice> make_hierarchy() {
+  Mesh3DDevice coarse = make_mesh_device(
+      {{0, 0}, {0, 1}, {2, 5}},
+      {0, 1, 3, 4},
+      {{0, 4}, {-3, -1}, {2, 9}, {100, 101}});
+  Mesh3DDevice fine = make_mesh_device(
+      {{-7, 3}},
+      {0, 2},
+      {{0, 8}, {10, 12}});
+  return {coarse, fine};
+}
+
+std::vector<double> field_values(const Field3DDevice<double>& f) {
+  auto host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, f.values);
+  return std::vector<double>(host.data(), host.data() + f.num_cells);
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// Round trip
+// ============================================================================
+
+TEST(CheckpointTest, RoundTripHierarchyAndFields) {
+  const auto levels = make_hierarchy();
+
+  auto rho = make_field<double>(levels[0], "rho");
+  auto temp = make_field<double>(levels[0], "temp");
+  auto phi = make_field<double>(levels[1], "phi");
+  std::vector<double> rho_values(rho.num_cells);
+  std::vector<double> temp_values(temp.num_cells);
+  std::vector<double> phi_values(phi.num_cells);
+  for (std::size_t i = 0; i < rho_values.size(); ++i) {
+    rho_values[i] = 0.5 * static_cast<double>(i);
+    temp_values[i] = 300.0 - static_cast<double>(i);
+  }
+  for (std::size_t i = 0; i < phi_values.size(); ++i) {
+    phi_values[i] = -static_cast<double>(i * i);
+  }
+  copy_to_view(rho_values, rho.values);
+  copy_to_view(temp_values, temp.values);
+  copy_to_view(phi_values, phi.values);
+
+  const std::vector<std::vector<NamedField<double, DeviceSpace>>> fields = {
+      {{"rho", rho}, {"temp", temp}},
+      {{"phi", phi}}};
+
+  // Tiny chunks and several threads: every array is split across writers
+  io::CheckpointOptions options;
+  options.chunk_bytes = 16;
+  options.num_threads = 4;
+
+  const std::string path = temp_path("subsetix_roundtrip.ckpt");
+  io::checkpoint(path, levels, fields, options);
+  const auto restored = io::restart<double>(path, options);
+
+  ASSERT_EQ(restored.levels.size(), 2u);
+  ASSERT_EQ(restored.fields.size(), 2u);
+  expect_same_mesh(restored.levels[0], levels[0]);
+  expect_same_mesh(restored.levels[1], levels[1]);
+
+  ASSERT_EQ(restored.fields[0].size(), 2u);
+  ASSERT_EQ(restored.fields[1].size(), 1u);
+  EXPECT_EQ(restored.fields[0][0].name, "rho");
+  EXPECT_EQ(restored.fields[0][1].name, "temp");
+  EXPECT_EQ(restored.fields[1][0].name, "phi");
+  EXPECT_EQ(field_values(restored.fields[0][0].field), rho_values);
+  EXPECT_EQ(field_values(restored.fields[0][1].field), temp_values);
+  EXPECT_EQ(field_values(restored.fields[1][0].field), phi_values);
+  EXPECT_EQ(restored.fields[1][0].field.interval_offsets.extent(0), 3u);
+
+  std::remove(path.c_str());
+}
+
+TEST(CheckpointTest, EmptyLevelRoundTrips) {
+  const std::vector<Mesh3DDevice> levels = {Mesh3DDevice{}, make_hierarchy()[1]};
+  const std::vector<std::vector<NamedField<double, DeviceSpace>>> fields;
+
+  const std::string path = temp_path("subsetix_empty_level.ckpt");
+  io::checkpoint(path, levels, fields);
+  const auto restored = io::restart<double>(path);
+
+  ASSERT_EQ(restored.levels.size(), 2u);
+  EXPECT_EQ(restored.levels[0].num_rows, 0u);
+  expect_same_mesh(restored.levels[1], levels[1]);
+
+  std::remove(path.c_str());
+}
+
+// ============================================================================
+// Error detection
+// ============================================================================
+
+TEST(CheckpointTest, CorruptedChunkIsDetected) {
+  const auto levels = make_hierarchy();
+  const std::vector<std::vector<NamedField<double, DeviceSpace>>> fields;
+
+  const std::string path = temp_path("subsetix_corrupt.ckpt");
+  io::checkpoint(path, levels, fields);
+
+  // Flip a byte inside the first chunk (right after the 16-byte header)
+  {
+    std::fstream f(path, std::ios::in | std::ios::out | std::ios::binary);
+    f.seekg(20);
+    char c = 0;
+    f.read(&c, 1);
+    f.seekp(20);
+    c = static_cast<char>(c ^ 0x5A);
+    f.write(&c, 1);
+  }
+
+  EXPECT_THROW(io::restart<double>(path), std::runtime_error);
+  std::remove(path.c_str());
+}
+
+TEST(CheckpointTest, CorruptTableCountsAreRejected) {
+  const auto levels = make_hierarchy();
+  const std::vector<std::vector<NamedField<double, DeviceSpace>>> fields;
+  const std::string path = temp_path("subsetix_corrupt_table.ckpt");
+
+  // Overwrite one 64-bit word of a fresh checkpoint; offsets relative to the
+  // trailer (table offset, array count, magic) or to the table start
+  auto corrupt_word = [&](bool from_table, std::streamoff at, std::uint64_t value) {
+    io::checkpoint(path, levels, fields);
+    std::fstream f(path, std::ios::in | std::ios::out | std::ios::binary);
+    f.seekg(-static_cast<std::streamoff>(3 * sizeof(std::uint64_t)), std::ios::end);
+    std::uint64_t table_offset = 0;
+    f.read(reinterpret_cast<char*>(&table_offset), sizeof(table_offset));
+    if (from_table) {
+      f.seekp(static_cast<std::streamoff>(table_offset) + at);
+    } else {
+      f.seekp(at - static_cast<std::streamoff>(3 * sizeof(std::uint64_t)), std::ios::end);
+    }
+    f.write(reinterpret_cast<const char*>(&value), sizeof(value));
+  };
+
+  // Array count far beyond what the table can hold
+  corrupt_word(false, sizeof(std::uint64_t), std::uint64_t(1) << 60);
+  EXPECT_THROW(io::restart<double>(path), std::runtime_error);
+
+  // Table offset past the trailer
+  corrupt_word(false, 0, std::uint64_t(1) << 40);
+  EXPECT_THROW(io::restart<double>(path), std::runtime_error);
+
+  // First name length larger than the table
+  corrupt_word(true, 0, std::uint64_t(1) << 50);
+  EXPECT_THROW(io::restart<double>(path), std::runtime_error);
+
+  // Element count of the first array no longer matches its chunks
+  const std::streamoff first_name = std::string("level/0/row_keys").size();
+  corrupt_word(true, sizeof(std::uint64_t) + first_name + sizeof(std::uint64_t),
+               std::uint64_t(1) << 40);
+  EXPECT_THROW(io::restart<double>(path), std::runtime_error);
+
+  std::remove(path.c_str());
+}
+
+TEST(CheckpointTest, RejectsForeignFile) {
+  const std::string path = temp_path("subsetix_foreign.ckpt");
+  {
+    std::ofstream f(path, std::ios::binary);
+    f << "this is not a checkpoint file at all";
+  }
+  EXPECT_THROW(io::restart<double>(path), std::runtime_error);
+  std::remove(path.c_str());
+}
+
+TEST(CheckpointTest, FieldOnWrongLevelThrows) {
+  const auto levels = make_hierarchy();
+  auto phi = make_field<double>(levels[1], "phi");
+  const std::vector<std::vector<NamedField<double, DeviceSpace>>> fields = {{{"phi", phi}}};
+
+  const std::string path = temp_path("subsetix_wrong_level.ckpt");
+  EXPECT_THROW(io::checkpoint(path, levels, fields), std::invalid_argument);
+  std::remove(path.c_str());
+}
@@ -0,0 +1,103 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/complement.hpp>
+#include <subsetix/reference.hpp>
+
+#include "test_utils/random_mesh.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+namespace {
+
+using namespace subsetix;
+namespace ref = subsetix::reference;
+
+ref::Rows device_complement(const ref::Rows& rows, const CellBox& box) {
+  return ref::to_rows(complement(ref::to_mesh(rows), box));
+}
+
+CellBox make_box(Coord x0, Coord x1, Coord y0, Coord y1, Coord z0, Coord z1) {
+  CellBox box;
+  box.lo[0] = x0;
+  box.hi[0] = x1;
+  box.lo[1] = y0;
+  box.hi[1] = y1;
+  box.lo[2] = z0;
+  box.hi[2] = z1;
+  return box;
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// Small hand-built cases
+// ============================================================================
+
+TEST(ComplementTest, EmptyBoxOrMesh) {
+  const ref::Rows rows = {{{0, 0}, {{0, 4}}}};
+  EXPECT_EQ(complement(ref::to_mesh(rows), CellBox{}).num_rows, 0u);
+
+  // Complement of nothing is the full box, one interval per row
+  const ref::Rows full = device_complement({}, make_box(-2, 3, 0, 2, 5, 7));
+  EXPECT_TRUE(ref::same_rows(full, {{{0, 5}, {{-2, 3}}},
+                                    {{0, 6}, {{-2, 3}}},
+                                    {{1, 5}, {{-2, 3}}},
+                                    {{1, 6}, {{-2, 3}}}}));
+}
+
+TEST(ComplementTest, GapsAndMissingRows) {
+  const ref::Rows rows = {
+      {{0, 0}, {{-5, 1}, {3, 4}, {4, 6}, {8, 20}}},  // clipped at both ends, touching pair
+      {{0, 1}, {{0, 10}}},                          // covers the box row: dropped
+      {{5, 5}, {{0, 10}}},                          // outside the box: ignored
+  };
+  const CellBox box = make_box(0, 10, 0, 2, 0, 2);
+  EXPECT_TRUE(ref::same_rows(device_complement(rows, box),
+                             {{{0, 0}, {{1, 3}, {6, 8}}},
+                              {{1, 0}, {{0, 10}}},
+                              {{1, 1}, {{0, 10}}}}));
+}
+
+TEST(ComplementTest, SplitsSolidAndFluid) {
+  // box ∩ A and box \ A partition the box
+  std::mt19937 rng(19);
+  const ref::Rows a = test::random_rows(rng, test::params_small());
+  const CellBox box = make_box(8, 40, 1, 6, 2, 7);
+  const ref::Rows fluid = device_complement(a, box);
+  const ref::Rows solid = ref::intersect(a, ref::complement({}, box));
+  EXPECT_TRUE(ref::intersect(fluid, solid).empty());
+  EXPECT_EQ(ref::count_cells(fluid) + ref::count_cells(solid), 32 * 5 * 5);
+}
+
+// ============================================================================
+// Random meshes against the reference
+// ============================================================================
+
+TEST(ComplementTest, MatchesReference) {
+  std::mt19937 rng(23);
+  for (const test::RandomMeshParams& p :
+       {test::params_small(), test::params_low_extreme(), test::params_high_extreme(),
+        test::params_full_range()}) {
+    for (int trial = 0; trial < 10; ++trial) {
+      const ref::Rows rows = test::random_rows(rng, p);
+      // Bounding box, then a box cutting through the rows on every axis
+      CellBox box = ref::bounding_box(rows);
+      EXPECT_TRUE(ref::same_rows(device_complement(rows, box), ref::complement(rows, box)))
+          << "bounding box, trial " << trial;
+      if (box.empty()) {
+        continue;
+      }
+      for (int a = 0; a < 3; ++a) {
+        const std::int64_t mid = (static_cast<std::int64_t>(box.lo[a]) + box.hi[a]) / 2;
+        box.hi[a] = static_cast<Coord>(mid + 1);
+      }
+      EXPECT_TRUE(ref::same_rows(device_complement(rows, box), ref::complement(rows, box)))
+          << "cut box, trial " << trial;
+    }
+  }
+}
@@ -0,0 +1,136 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/components.hpp>
+#include <subsetix/reference.hpp>
+
+#include "test_utils/random_mesh.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+namespace {
+
+using namespace subsetix;
+namespace ref = subsetix::reference;
+
+// Device labels on the host, in interval order
+std::vector<std::size_t> device_labels(const ref::Rows& rows, Connectivity c,
+                                       std::size_t* num_components = nullptr) {
+  const Mesh3DDevice mesh = ref::to_mesh(rows);
+  const auto components = label_components(mesh, c);
+  if (num_components != nullptr) {
+    *num_components = components.num_components;
+  }
+  std::vector<std::size_t> out(mesh.num_intervals);
+  if (!out.empty()) {
+    auto h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), components.labels);
+    for (std::size_t k = 0; k < out.size(); ++k) {
+      out[k] = h(k);
+    }
+  }
+  return out;
+}
+
+std::size_t count_components(const ref::Rows& rows, Connectivity c) {
+  std::size_t n = 0;
+  device_labels(rows, c, &n);
+  return n;
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// Small hand-built cases
+// ============================================================================
+
+TEST(ComponentsTest, EmptyMesh) {
+  const auto components = label_components(Mesh3DDevice{});
+  EXPECT_EQ(components.num_components, 0u);
+  EXPECT_EQ(components.labels.extent(0), 0u);
+}
+
+TEST(ComponentsTest, SeparateBoxes) {
+  ref::Rows rows;
+  for (Coord y = 0; y < 3; ++y) {
+    for (Coord z = 0; z < 3; ++z) {
+      rows[{y, z}] = {{0, 4}, {10, 12}};
+    }
+  }
+  std::size_t n = 0;
+  const std::vector<std::size_t> labels = device_labels(rows, Connectivity::Face, &n);
+  EXPECT_EQ(n, 2u);
+  for (std::size_t k = 0; k < labels.size(); ++k) {
+    EXPECT_EQ(labels[k], k % 2);  // first box is met first
+  }
+}
+
+TEST(ComponentsTest, TouchingIntervalsAreConnected) {
+  const ref::Rows rows = {{{0, 0}, {{0, 4}, {4, 6}, {7, 9}}}};
+  EXPECT_EQ(device_labels(rows, Connectivity::Face), (std::vector<std::size_t>{0, 0, 1}));
+}
+
+TEST(ComponentsTest, DiagonalRowsDependOnConnectivity) {
+  // Rows (0, 0) and (1, 1) share an edge along x
+  const ref::Rows rows = {{{0, 0}, {{0, 4}}}, {{1, 1}, {{2, 6}}}};
+  EXPECT_EQ(count_components(rows, Connectivity::Face), 2u);
+  EXPECT_EQ(count_components(rows, Connectivity::Edge), 1u);
+  EXPECT_EQ(count_components(rows, Connectivity::Vertex), 1u);
+
+  // Rows (0, 1) and (1, 0): the (y+1, z-1) direction
+  const ref::Rows anti = {{{0, 1}, {{0, 4}}}, {{1, 0}, {{3, 5}}}};
+  EXPECT_EQ(count_components(anti, Connectivity::Face), 2u);
+  EXPECT_EQ(count_components(anti, Connectivity::Edge), 1u);
+}
+
+TEST(ComponentsTest, CornerContactNeedsVertexConnectivity) {
+  // Face rows one cell apart on x share an edge; diagonal rows only a corner
+  const ref::Rows edge = {{{0, 0}, {{0, 4}}}, {{1, 0}, {{4, 6}}}};
+  EXPECT_EQ(count_components(edge, Connectivity::Face), 2u);
+  EXPECT_EQ(count_components(edge, Connectivity::Edge), 1u);
+
+  const ref::Rows corner = {{{0, 0}, {{0, 4}}}, {{1, 1}, {{4, 6}}}};
+  EXPECT_EQ(count_components(corner, Connectivity::Edge), 2u);
+  EXPECT_EQ(count_components(corner, Connectivity::Vertex), 1u);
+}
+
+TEST(ComponentsTest, ComponentCells) {
+  const ref::Rows rows = {{{0, 0}, {{0, 4}, {10, 11}}}, {{0, 1}, {{2, 8}}}};
+  const Mesh3DDevice mesh = ref::to_mesh(rows);
+  const auto components = label_components(mesh);
+  ASSERT_EQ(components.num_components, 2u);
+  auto cells = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                   component_cells(mesh, components));
+  EXPECT_EQ(cells(0), 10u);
+  EXPECT_EQ(cells(1), 1u);
+}
+
+// ============================================================================
+// Random meshes against the reference
+// ============================================================================
+
+TEST(ComponentsTest, MatchesReference) {
+  std::mt19937 rng(11);
+  std::vector<test::RandomMeshParams> windows = {test::params_small(), test::params_low_extreme(),
+                                                 test::params_high_extreme()};
+  // Dense rows with short gaps, so that components span many rows
+  test::RandomMeshParams dense;
+  dense.row_span = 12;
+  dense.row_fill = 0.6;
+  dense.x_hi = 24;
+  dense.max_intervals = 6;
+  windows.push_back(dense);
+
+  for (const test::RandomMeshParams& p : windows) {
+    for (int trial = 0; trial < 10; ++trial) {
+      const ref::Rows rows = test::random_rows(rng, p);
+      for (Connectivity c : {Connectivity::Face, Connectivity::Edge, Connectivity::Vertex}) {
+        EXPECT_EQ(device_labels(rows, c), ref::label_components(rows, c))
+            << "trial " << trial << ", connectivity " << static_cast<int>(c);
+      }
+    }
+  }
+}
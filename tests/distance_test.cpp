@@ -0,0 +1,118 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/distance.hpp>
+#include <subsetix/reference.hpp>
+
+#include "test_utils/random_mesh.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace subsetix;
+namespace ref = subsetix::reference;
+using subsetix::test::block;
+
+// Device distances on the host, in cell traversal order
+std::vector<double> device_distances(const ref::Rows& rows, double max_distance = INFINITY) {
+  const auto field = distance_transform(ref::to_mesh(rows), max_distance);
+  const auto h = field_to<Kokkos::HostSpace>(field);
+  std::vector<double> out(h.num_cells);
+  for (std::size_t c = 0; c < h.num_cells; ++c) {
+    out[c] = h.values(c);
+  }
+  return out;
+}
+
+void expect_distances(const std::vector<double>& got, const std::vector<double>& expected) {
+  ASSERT_EQ(got.size(), expected.size());
+  for (std::size_t c = 0; c < got.size(); ++c) {
+    EXPECT_NEAR(got[c], expected[c], 1e-5 * expected[c]) << "cell " << c;
+  }
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// Small hand-built cases
+// ============================================================================
+
+TEST(DistanceTest, EmptyMesh) {
+  const auto field = distance_transform(Mesh3DDevice{});
+  EXPECT_EQ(field.num_cells, 0u);
+}
+
+TEST(DistanceTest, SingleCell) {
+  expect_distances(device_distances({{{3, -4}, {{7, 8}}}}), {1.0});
+}
+
+TEST(DistanceTest, BlockCentre) {
+  const std::vector<double> d = device_distances(block(5));
+  ASSERT_EQ(d.size(), 125u);
+  // Cell (2, 2, 2): row (2, 2) is row 12, x = 2
+  EXPECT_DOUBLE_EQ(d[12 * 5 + 2], 3.0);
+  // Cell (1, 1, 1): nearest outside cell is 2 steps away on any axis
+  EXPECT_DOUBLE_EQ(d[6 * 5 + 1], 2.0);
+  expect_distances(d, ref::distance_transform(block(5)));
+}
+
+TEST(DistanceTest, DiagonalHole) {
+  // 7^3 block without (1, 1, 1): the centre (3, 3, 3) is sqrt(12) from the
+  // hole, closer than the faces (4)
+  ref::Rows rows = block(7);
+  rows[{1, 1}] = {{0, 1}, {2, 7}};
+  const std::vector<double> d = device_distances(rows);
+  // Row (3, 3) is row 24 and the hole removes one cell before it
+  EXPECT_NEAR(d[24 * 7 - 1 + 3], std::sqrt(12.0), 1e-5);
+  expect_distances(d, ref::distance_transform(rows));
+}
+
+TEST(DistanceTest, TouchingIntervalsFormOneRun) {
+  ref::Rows rows = block(5);
+  rows[{2, 2}] = {{0, 2}, {2, 5}};
+  expect_distances(device_distances(rows), ref::distance_transform(block(5)));
+}
+
+TEST(DistanceTest, MaxDistanceClamps) {
+  const std::vector<double> d = device_distances(block(7), 1.5);
+  const std::vector<double> r = ref::distance_transform(block(7));
+  ASSERT_EQ(d.size(), r.size());
+  for (std::size_t c = 0; c < d.size(); ++c) {
+    EXPECT_NEAR(d[c], std::min(r[c], 1.5), 1e-6) << "cell " << c;
+  }
+  EXPECT_THROW(distance_transform(ref::to_mesh(block(2)), -1.0), std::invalid_argument);
+}
+
+// ============================================================================
+// Random meshes against the reference
+// ============================================================================
+
+TEST(DistanceTest, MatchesReference) {
+  std::mt19937 rng(17);
+  std::vector<test::RandomMeshParams> windows = {test::params_small(), test::params_low_extreme(),
+                                                 test::params_high_extreme()};
+  test::RandomMeshParams dense;
+  dense.row_span = 10;
+  dense.row_fill = 0.9;
+  dense.x_hi = 24;
+  dense.max_intervals = 2;
+  windows.push_back(dense);
+
+  for (const test::RandomMeshParams& p : windows) {
+    for (int trial = 0; trial < 5; ++trial) {
+      const ref::Rows rows = test::random_rows(rng, p);
+      SCOPED_TRACE("x in [" + std::to_string(p.x_lo) + ", " + std::to_string(p.x_hi) +
+                   "], trial " + std::to_string(trial));
+      expect_distances(device_distances(rows), ref::distance_transform(rows));
+    }
+  }
+}
@@ -0,0 +1,187 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/field.hpp>
+#include <subsetix/distributed/mesh.hpp>
+#include <subsetix/distributed/halo.hpp>
+#include <subsetix/intersection/v1.hpp>
+
+#include "test_utils/mesh_helpers.hpp"
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <array>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+
+using namespace subsetix;
+using namespace subsetix::distributed;
+using subsetix::intersection::v1::mesh_to;
+using subsetix::test::make_mesh_device;
+
+using Cell = std::array<Coord, 3>;  // (y, z, x): canonical traversal order
+
+// ============================================================================
+// Test helpers
+// ============================================================================
+
+// Rows (y, z) in [0, n)^2 minus a diagonal band; two intervals per row
+Mesh3DDevice make_global_mesh(int n, int shift) {
+  std::vector<RowKey> keys;
+  std::vector<std::size_t> ptr = {0};
+  std::vector<Interval> iv;
+  for (Coord y = 0; y < n; ++y) {
+    for (Coord z = 0; z < n; ++z) {
+      if ((y + 2 * z) % 7 == 3) {
+        continue;
+      }
+      iv.push_back({shift + y % 3, 6});
+      iv.push_back({9, 12 + (z + shift) % 4});
+      keys.push_back({y, z});
+      ptr.push_back(iv.size());
+    }
+  }
+  return make_mesh_device(keys, ptr, iv);
+}
+
+std::vector<Cell> cells_of(const Mesh3DDevice& mesh) {
+  const Mesh3DHost host = mesh_to<Kokkos::HostSpace>(mesh);
+  std::vector<Cell> cells;
+  for (std::size_t i = 0; i < host.num_rows; ++i) {
+    for (std::size_t k = host.row_ptr(i); k < host.row_ptr(i + 1); ++k) {
+      for (Coord x = host.intervals(k).begin; x < host.intervals(k).end; ++x) {
+        cells.push_back({host.row_keys(i).y, host.row_keys(i).z, x});
+      }
+    }
+  }
+  return cells;
+}
+
+RowOwnership<Kokkos::HostSpace> host_ownership(const DistributedMesh3DDevice& mesh) {
+  RowOwnership<Kokkos::HostSpace> own;
+  own.curve = mesh.ownership.curve;
+  own.anchor = mesh.ownership.anchor;
+  own.num_ranks = mesh.ownership.num_ranks;
+  own.key_begin = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{},
+                                                      mesh.ownership.key_begin);
+  return own;
+}
+
+double cell_value(const Cell& c) {
+  return c[2] + 100.0 * c[0] + 10000.0 * c[1];
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// Distribution
+// ============================================================================
+
+TEST(DistributedTest, DistributeSplitsRowsByOwner) {
+  const Mesh3DDevice global = make_global_mesh(12, 0);
+  const auto mesh = distribute(global, MPI_COMM_WORLD);
+  const auto own = host_ownership(mesh);
+
+  const Mesh3DHost local = mesh_to<Kokkos::HostSpace>(mesh.local);
+  for (std::size_t i = 0; i < local.num_rows; ++i) {
+    EXPECT_EQ(own.owner(local.row_keys(i).y, local.row_keys(i).z), mesh.rank);
+  }
+
+  unsigned long long local_cells = count_cells(mesh.local);
+  unsigned long long total_cells = 0;
+  MPI_Allreduce(&local_cells, &total_cells, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, MPI_COMM_WORLD);
+  EXPECT_EQ(total_cells, count_cells(global));
+  if (mesh.size > 1) {
+    EXPECT_LT(local_cells, total_cells);
+  }
+}
+
+// ============================================================================
+// Halo
+// ============================================================================
+
+TEST(DistributedTest, HaloIsDilationMinusOwned) {
+  const Mesh3DDevice global = make_global_mesh(12, 0);
+  const auto mesh = distribute(global, MPI_COMM_WORLD);
+  const auto own = host_ownership(mesh);
+  const auto owned = cells_of(mesh.local);
+
+  for (const Coord width : {1, 2}) {
+    const auto plan = build_halo(mesh, width);
+
+    std::vector<Cell> expected;
+    for (const Cell& c : cells_of(global)) {
+      if (own.owner(c[0], c[1]) == mesh.rank) {
+        continue;
+      }
+      for (const Cell& o : owned) {
+        if (std::abs(c[0] - o[0]) <= width && std::abs(c[1] - o[1]) <= width &&
+            std::abs(c[2] - o[2]) <= width) {
+          expected.push_back(c);
+          break;
+        }
+      }
+    }
+    EXPECT_EQ(cells_of(plan.halo), expected) << "width " << width;
+  }
+}
+
+TEST(DistributedTest, ExchangeFillsGhostValues) {
+  const auto mesh = distribute(make_global_mesh(10, 1), MPI_COMM_WORLD, CurveType::Morton);
+  const auto plan = build_halo(mesh, 1);
+
+  auto field = make_field<double>(mesh.local, "u");
+  auto field_host = Kokkos::create_mirror_view(field.values);
+  const auto owned = cells_of(mesh.local);
+  for (std::size_t i = 0; i < owned.size(); ++i) {
+    field_host(i) = cell_value(owned[i]);
+  }
+  Kokkos::deep_copy(field.values, field_host);
+
+  auto ghosts = make_halo_field<double>(plan, "u_ghosts");
+  exchange_halo(mesh, plan, field, ghosts);
+
+  const auto halo = cells_of(plan.halo);
+  ASSERT_EQ(ghosts.num_cells, halo.size());
+  auto ghost_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, ghosts.values);
+  for (std::size_t i = 0; i < halo.size(); ++i) {
+    EXPECT_DOUBLE_EQ(ghost_host(i), cell_value(halo[i])) << "ghost " << i;
+  }
+}
+
+TEST(DistributedTest, NegativeWidthThrows) {
+  const auto mesh = distribute(make_global_mesh(4, 0), MPI_COMM_WORLD);
+  EXPECT_THROW(build_halo(mesh, -1), std::invalid_argument);
+}
+
+// ============================================================================
+// Set operations
+// ============================================================================
+
+TEST(DistributedTest, IntersectionMatchesGlobal) {
+  const Mesh3DDevice global_a = make_global_mesh(12, 0);
+  const Mesh3DDevice global_b = make_global_mesh(12, 2);
+  const auto a = distribute(global_a, MPI_COMM_WORLD);
+  const auto own = host_ownership(a);
+
+  std::vector<Cell> expected;
+  for (const Cell& c : cells_of(intersection::v1::intersect_meshes(global_a, global_b))) {
+    if (own.owner(c[0], c[1]) == a.rank) {
+      expected.push_back(c);
+    }
+  }
+
+  // Same ownership: purely local
+  const auto b_aligned = distribute(global_b, MPI_COMM_WORLD);
+  EXPECT_EQ(cells_of(intersect_meshes(a, b_aligned).local), expected);
+
+  // Different ownership: rows of B move to the owners under A's map
+  const auto b_other = distribute(global_b, MPI_COMM_WORLD, CurveType::Morton);
+  const auto result = intersect_meshes(a, b_other);
+  EXPECT_EQ(cells_of(result.local), expected);
+  EXPECT_TRUE(same_ownership(result.ownership, a.ownership));
+}
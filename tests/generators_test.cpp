@@ -0,0 +1,169 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/generators.hpp>
+#include <subsetix/intersection/v1.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+
+namespace {
+
+using namespace subsetix;
+using subsetix::intersection::v1::mesh_to;
+namespace gen = subsetix::generators;
+
+// ============================================================================
+// Test helpers
+// ============================================================================
+
+// Check the Mesh3D invariants and return the number of cells
+std::int64_t check_mesh(const Mesh3DDevice& mesh) {
+  const Mesh3DHost h = mesh_to<Kokkos::HostSpace>(mesh);
+  std::int64_t cells = 0;
+  if (h.num_rows == 0) {
+    EXPECT_EQ(h.num_intervals, 0u);
+    return 0;
+  }
+  EXPECT_EQ(h.row_ptr(0), 0u);
+  EXPECT_EQ(h.row_ptr(h.num_rows), h.num_intervals);
+  for (std::size_t i = 0; i < h.num_rows; ++i) {
+    if (i > 0) {
+      EXPECT_TRUE(h.row_keys(i - 1) < h.row_keys(i)) << "row " << i;
+    }
+    EXPECT_LT(h.row_ptr(i), h.row_ptr(i + 1)) << "empty row " << i;
+    for (std::size_t k = h.row_ptr(i); k < h.row_ptr(i + 1); ++k) {
+      EXPECT_LT(h.intervals(k).begin, h.intervals(k).end) << "interval " << k;
+      if (k > h.row_ptr(i)) {
+        EXPECT_LE(h.intervals(k - 1).end, h.intervals(k).begin) << "interval " << k;
+      }
+      cells += h.intervals(k).size();
+    }
+  }
+  return cells;
+}
+
+bool same_mesh(const Mesh3DDevice& a, const Mesh3DDevice& b) {
+  const Mesh3DHost ha = mesh_to<Kokkos::HostSpace>(a);
+  const Mesh3DHost hb = mesh_to<Kokkos::HostSpace>(b);
+  if (ha.num_rows != hb.num_rows || ha.num_intervals != hb.num_intervals) {
+    return false;
+  }
+  for (std::size_t i = 0; i < ha.num_rows; ++i) {
+    if (ha.row_keys(i) != hb.row_keys(i) || ha.row_ptr(i + 1) != hb.row_ptr(i + 1)) {
+      return false;
+    }
+  }
+  for (std::size_t k = 0; k < ha.num_intervals; ++k) {
+    if (ha.intervals(k).begin != hb.intervals(k).begin ||
+        ha.intervals(k).end != hb.intervals(k).end) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// Families
+// ============================================================================
+
+TEST(GeneratorsTest, SphereShellMatchesBruteForce) {
+  const gen::SphereShell shell{10, 4, 9};
+  std::int64_t expected = 0;
+  for (Coord z = 0; z <= 20; ++z) {
+    for (Coord y = 0; y <= 20; ++y) {
+      for (Coord x = 0; x <= 20; ++x) {
+        const std::int64_t d2 = (x - 10) * (x - 10) + (y - 10) * (y - 10) + (z - 10) * (z - 10);
+        expected += (d2 >= 16 && d2 < 81) ? 1 : 0;
+      }
+    }
+  }
+  EXPECT_EQ(check_mesh(gen::generate(shell)), expected);
+}
+
+TEST(GeneratorsTest, BoxIsDense) {
+  EXPECT_EQ(check_mesh(gen::generate(gen::cube(12))), 12 * 12 * 12);
+  EXPECT_EQ(check_mesh(gen::generate(gen::Box{{2, -3, 0}, {5, 1, 2}})), 3 * 4 * 2);
+  EXPECT_EQ(check_mesh(gen::generate(gen::Box{{4, 0, 0}, {4, 8, 8}})), 0);
+}
+
+TEST(GeneratorsTest, MengerSpongeCellCount) {
+  EXPECT_EQ(check_mesh(gen::generate(gen::MengerSponge{1})), 20);
+  EXPECT_EQ(check_mesh(gen::generate(gen::MengerSponge{3})), 20 * 20 * 20);
+}
+
+TEST(GeneratorsTest, RandomBoxesAreDeterministic) {
+  const gen::RandomBoxes boxes{64, 8, 0.3, 42};
+  const Mesh3DDevice a = gen::generate(boxes);
+  EXPECT_GT(check_mesh(a), 0);
+  EXPECT_TRUE(same_mesh(a, gen::generate(boxes)));
+
+  gen::RandomBoxes other = boxes;
+  other.seed = 43;
+  EXPECT_FALSE(same_mesh(a, gen::generate(other)));
+}
+
+TEST(GeneratorsTest, StripedRowsHaveFixedPeriod) {
+  const Mesh3DDevice mesh = gen::generate(gen::StripedRows{32, 3, 2, 5});
+  check_mesh(mesh);
+
+  const Mesh3DHost h = mesh_to<Kokkos::HostSpace>(mesh);
+  EXPECT_EQ(h.num_rows, 32u * 32u);
+  for (std::size_t i = 0; i < h.num_rows; ++i) {
+    for (std::size_t k = h.row_ptr(i) + 1; k < h.row_ptr(i + 1); ++k) {
+      EXPECT_EQ(h.intervals(k).begin - h.intervals(k - 1).begin, 5);
+    }
+  }
+}
+
+TEST(GeneratorsTest, PowerLawRowsAreSkewed) {
+  const Mesh3DDevice mesh = gen::generate(gen::PowerLawRows{64, 1.2, 256, 3});
+  check_mesh(mesh);
+
+  const Mesh3DHost h = mesh_to<Kokkos::HostSpace>(mesh);
+  EXPECT_EQ(h.num_rows, 64u * 64u);
+  std::size_t longest = 0;
+  std::size_t singles = 0;
+  for (std::size_t i = 0; i < h.num_rows; ++i) {
+    const std::size_t len = h.row_ptr(i + 1) - h.row_ptr(i);
+    EXPECT_LE(len, 256u);
+    longest = (len > longest) ? len : longest;
+    singles += (len == 1) ? 1 : 0;
+  }
+  EXPECT_GT(longest, 16u);
+  EXPECT_GT(singles, h.num_rows / 4);
+}
+
+TEST(GeneratorsTest, InvalidParametersThrow) {
+  EXPECT_THROW(gen::generate(gen::RandomBoxes{64, 0, 0.3, 1}), std::invalid_argument);
+  EXPECT_THROW(gen::generate(gen::StripedRows{32, 3, 0, 1}), std::invalid_argument);
+  EXPECT_THROW(gen::generate(gen::StripedRows{32, 0, 2, 1}), std::invalid_argument);
+  EXPECT_THROW(gen::generate(gen::StripedRows{32, 1, -1, 1}), std::invalid_argument);
+  EXPECT_THROW(gen::generate(gen::PowerLawRows{64, 0.0, 256, 1}), std::invalid_argument);
+  EXPECT_THROW(gen::generate(gen::PowerLawRows{64, 1.2, -1, 1}), std::invalid_argument);
+
+  // Smallest valid parameters
+  EXPECT_GT(check_mesh(gen::generate(gen::RandomBoxes{8, 1, 0.5, 1})), 0);
+  EXPECT_EQ(check_mesh(gen::generate(gen::StripedRows{4, 1, 1, 1})), 4 * 4 * 2);
+}
+
+TEST(GeneratorsTest, AmrLevelsNest) {
+  // Level 0: 32^3 box minus a 16^3 hole; level 1: same at twice the resolution;
+  // level 2 (finest): full 32^3 box
+  EXPECT_EQ(check_mesh(gen::generate(gen::amr_level(32, 3, 0, 9))), 32 * 32 * 32 - 16 * 16 * 16);
+  EXPECT_EQ(check_mesh(gen::generate(gen::amr_level(32, 3, 1, 9))), 32 * 32 * 32 - 16 * 16 * 16);
+  EXPECT_EQ(check_mesh(gen::generate(gen::amr_level(32, 3, 2, 9))), 32 * 32 * 32);
+
+  EXPECT_THROW(gen::amr_level(32, 3, 3, 9), std::invalid_argument);
+}
+
+TEST(GeneratorsTest, GenerateOnHost) {
+  const Mesh3DHost host = gen::generate<Kokkos::HostSpace>(gen::MengerSponge{2});
+  // 8 of the 9 digit pairs of (y, z) are allowed at each of the two positions
+  EXPECT_EQ(host.num_rows, 8u * 8u);
+}
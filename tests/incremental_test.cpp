@@ -0,0 +1,137 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/intersection/v1.hpp>
+#include <subsetix/intersection/incremental.hpp>
+#include <subsetix/reference.hpp>
+
+#include "test_utils/mesh_helpers.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+using namespace subsetix;
+namespace ref = subsetix::reference;
+using subsetix::intersection::v1::intersect_meshes;
+using subsetix::intersection::v1::RowKeyRange;
+using subsetix::intersection::v1::update_intersection;
+using subsetix::test::expect_same_mesh;
+using subsetix::test::make_mesh_device;
+
+// ============================================================================
+// Test helpers
+// ============================================================================
+
+// Random rows in [0, 6) x [0, 3), one or two intervals per row in [0, 16)
+ref::Rows make_random_rows(std::mt19937& rng) {
+  ref::Rows rows;
+  for (Coord y = 0; y < 6; ++y) {
+    for (Coord z = 0; z < 3; ++z) {
+      if (rng() % 3 == 0) {
+        continue;
+      }
+      ref::RowIntervals& row = rows[{y, z}];
+      const Coord b = static_cast<Coord>(rng() % 6);
+      row.push_back({b, b + 1 + static_cast<Coord>(rng() % 4)});
+      if (rng() % 2 == 0) {
+        const Coord c = 10 + static_cast<Coord>(rng() % 3);
+        row.push_back({c, c + 2});
+      }
+    }
+  }
+  return rows;
+}
+
+// Rows of base, except those with y in [y_lo, y_hi] which are taken from band
+ref::Rows splice_band(const ref::Rows& base, const ref::Rows& band, Coord y_lo, Coord y_hi) {
+  ref::Rows out;
+  for (const auto& [key, row] : base) {
+    if (key.y < y_lo || key.y > y_hi) {
+      out.emplace(key, row);
+    }
+  }
+  for (const auto& [key, row] : band) {
+    if (key.y >= y_lo && key.y <= y_hi) {
+      out.emplace(key, row);
+    }
+  }
+  return out;
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// Incremental update
+// ============================================================================
+
+TEST(IncrementalTest, BandUpdateMatchesRecompute) {
+  std::mt19937 rng(7);
+  for (int trial = 0; trial < 20; ++trial) {
+    const ref::Rows old_rows = make_random_rows(rng);
+    const ref::Rows band_rows = make_random_rows(rng);
+    const Coord y_lo = static_cast<Coord>(rng() % 6);
+    const Coord y_hi = y_lo + static_cast<Coord>(rng() % 2);
+
+    const Mesh3DDevice old_a = ref::to_mesh(old_rows);
+    const Mesh3DDevice new_a = ref::to_mesh(splice_band(old_rows, band_rows, y_lo, y_hi));
+    const Mesh3DDevice B = ref::to_mesh(make_random_rows(rng));
+
+    const Mesh3DDevice prev = intersect_meshes(old_a, B);
+    const std::vector<RowKeyRange> changed = {{{y_lo, 0}, {y_hi, 2}}};
+    expect_same_mesh(update_intersection(prev, new_a, B, changed), intersect_meshes(new_a, B));
+  }
+}
+
+TEST(IncrementalTest, SeveralOverlappingBands) {
+  std::mt19937 rng(11);
+  const ref::Rows old_rows = make_random_rows(rng);
+  const ref::Rows band_rows = make_random_rows(rng);
+  const ref::Rows new_rows = splice_band(splice_band(old_rows, band_rows, 0, 0), band_rows, 3, 5);
+
+  const Mesh3DDevice old_a = ref::to_mesh(old_rows);
+  const Mesh3DDevice new_a = ref::to_mesh(new_rows);
+  const Mesh3DDevice B = ref::to_mesh(make_random_rows(rng));
+
+  const std::vector<RowKeyRange> changed = {
+      {{4, 0}, {5, 2}}, {{0, 0}, {0, 2}}, {{3, 0}, {4, 1}}};
+  expect_same_mesh(update_intersection(intersect_meshes(old_a, B), new_a, B, changed),
+                   intersect_meshes(new_a, B));
+}
+
+TEST(IncrementalTest, RowsRemovedAndAdded) {
+  const Mesh3DDevice old_a = make_mesh_device({{0, 0}, {1, 0}, {2, 0}}, {0, 1, 2, 3},
+                                              {{0, 8}, {0, 8}, {0, 8}});
+  const Mesh3DDevice new_a = make_mesh_device({{0, 0}, {1, 1}, {2, 0}}, {0, 1, 2, 3},
+                                              {{0, 8}, {2, 3}, {0, 8}});
+  const Mesh3DDevice B = make_mesh_device({{0, 0}, {1, 0}, {1, 1}, {2, 0}}, {0, 1, 2, 3, 4},
+                                          {{1, 2}, {1, 2}, {0, 4}, {5, 9}});
+
+  const Mesh3DDevice prev = intersect_meshes(old_a, B);
+  const std::vector<RowKeyRange> changed = {{{1, 0}, {1, 1}}};
+  expect_same_mesh(update_intersection(prev, new_a, B, changed), intersect_meshes(new_a, B));
+
+  // Nothing left in the band
+  const Mesh3DDevice cleared = make_mesh_device({{0, 0}, {2, 0}}, {0, 1, 2}, {{0, 8}, {0, 8}});
+  expect_same_mesh(update_intersection(prev, cleared, B, changed),
+                   intersect_meshes(cleared, B));
+}
+
+TEST(IncrementalTest, NoBandsReturnsPrevious) {
+  const Mesh3DDevice A = make_mesh_device({{0, 0}}, {0, 1}, {{0, 8}});
+  const Mesh3DDevice B = make_mesh_device({{0, 0}}, {0, 1}, {{4, 12}});
+  const Mesh3DDevice prev = intersect_meshes(A, B);
+
+  expect_same_mesh(update_intersection(prev, A, B, {}), prev);
+}
+
+TEST(IncrementalTest, InvertedBandThrows) {
+  const Mesh3DDevice A = make_mesh_device({{0, 0}}, {0, 1}, {{0, 8}});
+  const std::vector<RowKeyRange> changed = {{{2, 0}, {1, 0}}};
+  EXPECT_THROW(update_intersection(A, A, A, changed), std::invalid_argument);
+}
@@ -4,6 +4,8 @@
 #include <subsetix/mesh.hpp>
 #include <subsetix/intersection/v1.hpp>
 
+#include "test_utils/mesh_helpers.hpp"
+
 #include <gtest/gtest.h>
 
 #include <vector>
@@ -17,43 +19,11 @@ namespace {
 
 using namespace subsetix;
 // Import intersection v1 functions
+using subsetix::intersection::v1::intersect_inplace;
 using subsetix::intersection::v1::intersect_meshes;
 using subsetix::intersection::v1::mesh_to;
-
-// Helper function to create a mesh from host data
-Mesh3DDevice make_mesh_device(
-    const std::vector<RowKey>& row_keys_vec,
-    const std::vector<std::size_t>& row_ptr_vec,
-    const std::vector<Interval>& intervals_vec) {
-
-  Mesh3DHost host;
-  const std::size_t nrows = row_keys_vec.size();
-  const std::size_t nints = intervals_vec.size();
-
-  if (nrows == 0) {
-    return Mesh3DDevice{};
-  }
-
-  host.row_keys = Mesh3DHost::RowKeyView("test_row_keys", nrows);
-  host.row_ptr = Mesh3DHost::IndexView("test_row_ptr", nrows + 1);
-  host.intervals = Mesh3DHost::IntervalView("test_intervals", nints);
-
-  host.num_rows = nrows;
-  host.num_intervals = nints;
-
-  // Copy data
-  for (std::size_t i = 0; i < nrows; ++i) {
-    host.row_keys(i) = row_keys_vec[i];
-    host.row_ptr(i) = row_ptr_vec[i];
-  }
-  host.row_ptr(nrows) = row_ptr_vec[nrows];
-
-  for (std::size_t i = 0; i < nints; ++i) {
-    host.intervals(i) = intervals_vec[i];
-  }
-
-  return mesh_to<Kokkos::DefaultExecutionSpace::memory_space>(host);
-}
+using subsetix::test::expect_same_mesh;
+using subsetix::test::make_mesh_device;
 
 // Helper to compare host mesh with expected data
 void expect_mesh_eq(
@@ -954,3 +924,154 @@ TEST(IntersectionTest, AlternatingRowsWithWithoutIntervals) {
   EXPECT_EQ(result.num_rows, 10u);
   EXPECT_TRUE(verify_csr_invariants(result));
 }
+
+// ============================================================================
+// Execution space instances
+// ============================================================================
+
+TEST(IntersectionTest, ExplicitInstanceMatchesDefault) {
+  Mesh3DDevice A = make_mesh_device(
+      {{0, 0}, {0, 1}, {2, 0}}, {0, 2, 3, 4}, {{0, 4}, {6, 9}, {1, 3}, {0, 10}});
+  Mesh3DDevice B = make_mesh_device(
+      {{0, 0}, {2, 0}}, {0, 1, 2}, {{2, 8}, {5, 6}});
+
+  const Kokkos::DefaultExecutionSpace exec;
+  Mesh3DDevice result = intersect_meshes(exec, A, B);
+  exec.fence();
+
+  expect_mesh_eq(mesh_to<Kokkos::HostSpace>(result),
+                 {{0, 0}, {2, 0}}, {0, 2, 3}, {{2, 4}, {6, 8}, {5, 6}});
+}
+
+TEST(IntersectionTest, PartitionedInstancesRunIndependentOperations) {
+  Mesh3DDevice A1 = make_mesh_device({{0, 0}}, {0, 1}, {{0, 10}});
+  Mesh3DDevice B1 = make_mesh_device({{0, 0}}, {0, 1}, {{5, 15}});
+  Mesh3DDevice A2 = make_mesh_device({{1, 1}, {2, 2}}, {0, 1, 2}, {{0, 4}, {0, 4}});
+  Mesh3DDevice B2 = make_mesh_device({{2, 2}}, {0, 1}, {{3, 7}});
+
+  auto instances = Kokkos::Experimental::partition_space(Kokkos::DefaultExecutionSpace(), 1, 1);
+  Mesh3DDevice r1 = intersect_meshes(instances[0], A1, B1);
+  Mesh3DDevice r2 = intersect_meshes(instances[1], A2, B2);
+  instances[0].fence();
+  instances[1].fence();
+
+  expect_mesh_eq(mesh_to<Kokkos::HostSpace>(r1), {{0, 0}}, {0, 1}, {{5, 10}});
+  expect_mesh_eq(mesh_to<Kokkos::HostSpace>(r2), {{2, 2}}, {0, 1}, {{3, 4}});
+}
+
+// ============================================================================
+// Memory spaces
+// ============================================================================
+
+TEST(IntersectionTest, HostMeshesIntersectOnHostExecutionSpace) {
+  const Mesh3DHost A = mesh_to<Kokkos::HostSpace>(make_mesh_device(
+      {{0, 0}, {0, 1}, {2, 0}}, {0, 2, 3, 4}, {{0, 4}, {6, 9}, {1, 3}, {0, 10}}));
+  const Mesh3DHost B = mesh_to<Kokkos::HostSpace>(make_mesh_device(
+      {{0, 0}, {2, 0}}, {0, 1, 2}, {{2, 8}, {5, 6}}));
+
+  // Result stays in HostSpace: no copy through the device
+  const Mesh3DHost result = intersect_meshes(A, B);
+  expect_mesh_eq(result, {{0, 0}, {2, 0}}, {0, 2, 3}, {{2, 4}, {6, 8}, {5, 6}});
+
+  const Kokkos::DefaultHostExecutionSpace host_exec;
+  const Mesh3DHost explicit_result = intersect_meshes(host_exec, A, B);
+  host_exec.fence();
+  expect_mesh_eq(explicit_result, {{0, 0}, {2, 0}}, {0, 2, 3}, {{2, 4}, {6, 8}, {5, 6}});
+}
+
+TEST(IntersectionTest, HostAndDeviceResultsMatch) {
+  Mesh3DDevice A = make_mesh_device(
+      {{-1, 0}, {0, 0}, {0, 3}}, {0, 1, 3, 4}, {{-5, 5}, {0, 2}, {4, 8}, {1, 2}});
+  Mesh3DDevice B = make_mesh_device(
+      {{-1, 0}, {0, 0}, {1, 1}}, {0, 2, 3, 4}, {{-3, -1}, {0, 1}, {1, 6}, {0, 1}});
+
+  const Mesh3DHost on_device = mesh_to<Kokkos::HostSpace>(intersect_meshes(A, B));
+  const Mesh3DHost on_host =
+      intersect_meshes(mesh_to<Kokkos::HostSpace>(A), mesh_to<Kokkos::HostSpace>(B));
+
+  expect_same_mesh(on_host, on_device);
+}
+
+// ============================================================================
+// In-place intersection
+// ============================================================================
+
+TEST(IntersectionTest, InplaceReusesBuffersOfA) {
+  Mesh3DDevice A = make_mesh_device(
+      {{0, 0}, {0, 1}, {2, 0}}, {0, 2, 3, 4}, {{0, 4}, {6, 9}, {1, 3}, {0, 10}});
+  const Mesh3DDevice B = make_mesh_device(
+      {{0, 0}, {2, 0}}, {0, 1, 2}, {{2, 8}, {5, 6}});
+  const Interval* storage = A.intervals.data();
+
+  intersect_inplace(A, B);
+
+  EXPECT_EQ(A.intervals.data(), storage);
+  EXPECT_EQ(A.row_keys.extent(0), A.num_rows);
+  EXPECT_EQ(A.row_ptr.extent(0), A.num_rows + 1);
+  expect_mesh_eq(mesh_to<Kokkos::HostSpace>(A),
+                 {{0, 0}, {2, 0}}, {0, 2, 3}, {{2, 4}, {6, 8}, {5, 6}});
+}
+
+TEST(IntersectionTest, InplaceGrowsWhenRowsSplit) {
+  // One interval of A is split into three by B
+  Mesh3DDevice A = make_mesh_device({{0, 0}}, {0, 1}, {{0, 10}});
+  const Mesh3DDevice B = make_mesh_device({{0, 0}}, {0, 3}, {{1, 2}, {3, 4}, {5, 6}});
+
+  intersect_inplace(A, B);
+
+  expect_mesh_eq(mesh_to<Kokkos::HostSpace>(A), {{0, 0}}, {0, 3}, {{1, 2}, {3, 4}, {5, 6}});
+}
+
+TEST(IntersectionTest, InplaceEmptyResultAndSelfAlias) {
+  Mesh3DDevice A = make_mesh_device({{0, 0}, {1, 0}}, {0, 1, 2}, {{0, 4}, {2, 6}});
+  intersect_inplace(A, A);
+  expect_mesh_eq(mesh_to<Kokkos::HostSpace>(A), {{0, 0}, {1, 0}}, {0, 1, 2}, {{0, 4}, {2, 6}});
+
+  const Mesh3DDevice disjoint = make_mesh_device({{0, 0}}, {0, 1}, {{10, 12}});
+  intersect_inplace(A, disjoint);
+  EXPECT_EQ(A.num_rows, 0u);
+  EXPECT_EQ(A.num_intervals, 0u);
+}
+
+TEST(IntersectionTest, InplaceDefersRowsAheadOfTheirInput) {
+  // Row 0 grows from 1 to 4 intervals, so its output overlaps the input of
+  // row 1 and has to wait in the scratch; the other rows shrink
+  std::vector<RowKey> keys;
+  std::vector<std::size_t> ptr_a = {0};
+  std::vector<std::size_t> ptr_b = {0};
+  std::vector<Interval> intervals_a = {{0, 20}};
+  std::vector<Interval> intervals_b = {{1, 2}, {3, 4}, {5, 6}, {7, 8}};
+  keys.push_back({0, 0});
+  ptr_a.push_back(intervals_a.size());
+  ptr_b.push_back(intervals_b.size());
+  for (Coord y = 1; y < 40; ++y) {
+    keys.push_back({y, 0});
+    for (Coord x = 0; x < 16; x += 4) {
+      intervals_a.push_back({x, x + 2});
+    }
+    intervals_b.push_back({1, 5 + y % 8});
+    ptr_a.push_back(intervals_a.size());
+    ptr_b.push_back(intervals_b.size());
+  }
+  Mesh3DDevice A = make_mesh_device(keys, ptr_a, intervals_a);
+  const Mesh3DDevice B = make_mesh_device(keys, ptr_b, intervals_b);
+  const Interval* storage = A.intervals.data();
+
+  const Mesh3DDevice expected = intersect_meshes(A, B);
+  intersect_inplace(A, B);
+
+  EXPECT_EQ(A.intervals.data(), storage);
+  expect_same_mesh(A, expected);
+}
+
+TEST(IntersectionTest, InplaceMatchesOutOfPlaceOnHost) {
+  Mesh3DHost A = mesh_to<Kokkos::HostSpace>(make_mesh_device(
+      {{-1, 0}, {0, 0}, {0, 3}}, {0, 1, 3, 4}, {{-5, 5}, {0, 2}, {4, 8}, {1, 2}}));
+  const Mesh3DHost B = mesh_to<Kokkos::HostSpace>(make_mesh_device(
+      {{-1, 0}, {0, 0}, {1, 1}}, {0, 2, 3, 4}, {{-3, -1}, {0, 1}, {1, 6}, {0, 1}}));
+
+  const Mesh3DHost expected = intersect_meshes(A, B);
+  intersect_inplace(Kokkos::DefaultHostExecutionSpace(), A, B);
+
+  expect_same_mesh(A, expected);
+}
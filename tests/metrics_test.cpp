@@ -0,0 +1,105 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/metrics.hpp>
+#include <subsetix/reference.hpp>
+
+#include "test_utils/random_mesh.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace {
+
+using namespace subsetix;
+namespace ref = subsetix::reference;
+
+MeshMetrics device_metrics(const ref::Rows& a, const ref::Rows& b) {
+  return compare_meshes(ref::to_mesh(a), ref::to_mesh(b));
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// Small hand-built cases
+// ============================================================================
+
+TEST(MetricsTest, EmptyMeshes) {
+  const MeshMetrics m = device_metrics({}, {});
+  EXPECT_EQ(m.union_cells, 0u);
+  EXPECT_DOUBLE_EQ(m.iou, 1.0);
+  EXPECT_EQ(m.max_row_distance, 0);
+  EXPECT_EQ(m.unmatched_rows, 0u);
+
+  const MeshMetrics one = device_metrics({{{0, 0}, {{0, 4}}}}, {});
+  EXPECT_EQ(one.cells_a, 4u);
+  EXPECT_DOUBLE_EQ(one.iou, 0.0);
+  EXPECT_EQ(one.unmatched_rows, 1u);
+}
+
+TEST(MetricsTest, IdenticalMeshes) {
+  const ref::Rows a = {{{0, 0}, {{0, 4}, {6, 9}}}, {{1, 0}, {{-3, 2}}}};
+  const MeshMetrics m = device_metrics(a, a);
+  EXPECT_EQ(m.intersection_cells, 12u);
+  EXPECT_EQ(m.union_cells, 12u);
+  EXPECT_DOUBLE_EQ(m.iou, 1.0);
+  EXPECT_EQ(m.max_row_distance, 0);
+}
+
+TEST(MetricsTest, OverlapAndRowDistance) {
+  const ref::Rows a = {{{0, 0}, {{0, 10}}}, {{0, 1}, {{0, 2}}}};
+  const ref::Rows b = {{{0, 0}, {{0, 2}, {8, 10}}}, {{2, 2}, {{0, 1}}}};
+  const MeshMetrics m = device_metrics(a, b);
+  EXPECT_EQ(m.cells_a, 12u);
+  EXPECT_EQ(m.cells_b, 5u);
+  EXPECT_EQ(m.intersection_cells, 4u);
+  EXPECT_EQ(m.union_cells, 13u);
+  EXPECT_DOUBLE_EQ(m.iou, 4.0 / 13.0);
+  // Cells 4 and 5 of row (0, 0) in A are 3 cells from the nearest cell of B
+  EXPECT_EQ(m.max_row_distance, 3);
+  EXPECT_EQ(m.unmatched_rows, 2u);
+}
+
+// ============================================================================
+// Random meshes against the reference
+// ============================================================================
+
+TEST(MetricsTest, MatchesReference) {
+  std::mt19937 rng(29);
+  for (const test::RandomMeshParams& p :
+       {test::params_small(), test::params_low_extreme(), test::params_high_extreme()}) {
+    for (int trial = 0; trial < 20; ++trial) {
+      const ref::Rows a = test::random_rows(rng, p);
+      const ref::Rows b = test::random_rows(rng, p);
+      const MeshMetrics m = device_metrics(a, b);
+
+      const std::int64_t inter = ref::count_cells(ref::intersect(a, b));
+      const std::int64_t uni = ref::count_cells(ref::unite(a, b));
+      EXPECT_EQ(m.cells_a, static_cast<std::size_t>(ref::count_cells(a)));
+      EXPECT_EQ(m.cells_b, static_cast<std::size_t>(ref::count_cells(b)));
+      EXPECT_EQ(m.intersection_cells, static_cast<std::size_t>(inter));
+      EXPECT_EQ(m.union_cells, static_cast<std::size_t>(uni));
+      EXPECT_DOUBLE_EQ(m.iou, uni == 0 ? 1.0 : static_cast<double>(inter) / uni);
+
+      std::int64_t max_distance = 0;
+      std::size_t unmatched = 0;
+      for (const auto& [key, row] : a) {
+        const auto it = b.find(key);
+        if (it == b.end()) {
+          ++unmatched;
+        } else {
+          max_distance = std::max(max_distance, ref::row_hausdorff(row, it->second));
+        }
+      }
+      for (const auto& [key, row] : b) {
+        unmatched += (a.count(key) == 0) ? 1 : 0;
+      }
+      EXPECT_EQ(m.max_row_distance, max_distance) << "trial " << trial;
+      EXPECT_EQ(m.unmatched_rows, unmatched) << "trial " << trial;
+    }
+  }
+}
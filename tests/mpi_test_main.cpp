@@ -0,0 +1,33 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <Kokkos_Core.hpp>
+#include <mpi.h>
+
+#include <gtest/gtest.h>
+
+int main(int argc, char** argv) {
+  // MPI first, then Kokkos (finalized in reverse order)
+  MPI_Init(&argc, &argv);
+  Kokkos::initialize(argc, argv);
+
+  ::testing::InitGoogleTest(&argc, argv);
+
+  // Only rank 0 prints the progress report
+  int rank = 0;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  if (rank != 0) {
+    auto& listeners = ::testing::UnitTest::GetInstance()->listeners();
+    delete listeners.Release(listeners.default_result_printer());
+  }
+
+  // Fail on every rank if any rank failed
+  const int local_result = RUN_ALL_TESTS();
+  int result = 0;
+  MPI_Allreduce(&local_result, &result, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+
+  Kokkos::finalize();
+  MPI_Finalize();
+
+  return result;
+}
@@ -0,0 +1,170 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/field.hpp>
+#include <subsetix/detail/neighbourhood.hpp>
+#include <subsetix/intersection/v1.hpp>
+
+#include "test_utils/mesh_helpers.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdlib>
+#include <random>
+#include <set>
+#include <vector>
+
+namespace {
+
+using namespace subsetix;
+using subsetix::intersection::v1::mesh_to;
+using subsetix::test::make_mesh_device;
+
+using Cell = std::array<Coord, 3>;  // (y, z, x): canonical traversal order
+
+// ============================================================================
+// Test helpers
+// ============================================================================
+
+std::vector<Cell> cells_of(const Mesh3DDevice& mesh) {
+  const Mesh3DHost host = mesh_to<Kokkos::HostSpace>(mesh);
+  std::vector<Cell> cells;
+  for (std::size_t i = 0; i < host.num_rows; ++i) {
+    for (std::size_t k = host.row_ptr(i); k < host.row_ptr(i + 1); ++k) {
+      for (Coord x = host.intervals(k).begin; x < host.intervals(k).end; ++x) {
+        cells.push_back({host.row_keys(i).y, host.row_keys(i).z, x});
+      }
+    }
+  }
+  return cells;
+}
+
+std::vector<Interval> intervals_of(const Mesh3DDevice& mesh) {
+  const Mesh3DHost host = mesh_to<Kokkos::HostSpace>(mesh);
+  std::vector<Interval> out;
+  for (std::size_t k = 0; k < host.num_intervals; ++k) {
+    out.push_back(host.intervals(k));
+  }
+  return out;
+}
+
+// Random mesh on [0, 6)^2 rows with up to three intervals per row in [0, 24)
+Mesh3DDevice make_random_mesh(unsigned seed) {
+  std::mt19937 rng(seed);
+  std::vector<RowKey> keys;
+  std::vector<std::size_t> ptr = {0};
+  std::vector<Interval> iv;
+  for (Coord y = 0; y < 6; ++y) {
+    for (Coord z = 0; z < 6; ++z) {
+      if (rng() % 3 == 0) {
+        continue;
+      }
+      Coord x = static_cast<Coord>(rng() % 4);
+      const int n = 1 + static_cast<int>(rng() % 3);
+      for (int k = 0; k < n; ++k) {
+        const Coord len = 1 + static_cast<Coord>(rng() % 4);
+        iv.push_back({x, x + len});
+        x += len + 1 + static_cast<Coord>(rng() % 5);
+      }
+      keys.push_back({y, z});
+      ptr.push_back(iv.size());
+    }
+  }
+  return make_mesh_device(keys, ptr, iv);
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// clip_to_neighbourhood
+// ============================================================================
+
+TEST(NeighbourhoodTest, ClipToNeighbourRow) {
+  const Mesh3DDevice candidate = make_mesh_device({{0, 0}}, {0, 1}, {{0, 20}});
+  const Mesh3DDevice near = make_mesh_device({{1, 0}}, {0, 1}, {{5, 7}});
+
+  const auto clipped = detail::clip_to_neighbourhood(candidate, near, 1);
+  ASSERT_EQ(clipped.num_rows, 1u);
+  const auto iv = intervals_of(clipped);
+  ASSERT_EQ(iv.size(), 1u);
+  EXPECT_EQ(iv[0].begin, 4);
+  EXPECT_EQ(iv[0].end, 8);
+}
+
+TEST(NeighbourhoodTest, OverlappingDilationsMergeAndGapsSplit) {
+  const Mesh3DDevice candidate = make_mesh_device({{0, 0}}, {0, 1}, {{0, 20}});
+  // Dilated: [-1, 3) from row (0, -1) and [2, 5) from row (0, 1) overlap;
+  // [11, 14) from row (0, 1) is separate
+  const Mesh3DDevice near = make_mesh_device(
+      {{0, -1}, {0, 1}}, {0, 1, 3}, {{0, 2}, {3, 4}, {12, 13}});
+
+  const auto iv = intervals_of(detail::clip_to_neighbourhood(candidate, near, 1));
+  ASSERT_EQ(iv.size(), 2u);
+  EXPECT_EQ(iv[0].begin, 0);
+  EXPECT_EQ(iv[0].end, 5);
+  EXPECT_EQ(iv[1].begin, 11);
+  EXPECT_EQ(iv[1].end, 14);
+}
+
+TEST(NeighbourhoodTest, FarMeshGivesEmptyClip) {
+  const Mesh3DDevice candidate = make_mesh_device({{0, 0}, {5, 5}}, {0, 1, 2}, {{0, 4}, {0, 4}});
+  const Mesh3DDevice near = make_mesh_device({{2, 2}}, {0, 1}, {{0, 4}});
+
+  EXPECT_EQ(detail::clip_to_neighbourhood(candidate, near, 1).num_rows, 0u);
+  EXPECT_EQ(detail::clip_to_neighbourhood(candidate, near, 3).num_rows, 2u);
+}
+
+TEST(NeighbourhoodTest, ClipMatchesBruteForce) {
+  for (unsigned seed = 1; seed <= 8; ++seed) {
+    const Mesh3DDevice candidate = make_random_mesh(seed);
+    const Mesh3DDevice near = make_random_mesh(100 + seed);
+    const Coord width = static_cast<Coord>(seed % 3);
+
+    const auto near_cells = cells_of(near);
+    const std::set<Cell> near_set(near_cells.begin(), near_cells.end());
+    std::vector<Cell> expected;
+    for (const Cell& c : cells_of(candidate)) {
+      bool covered = false;
+      for (const Cell& n : near_set) {
+        if (std::abs(c[0] - n[0]) <= width && std::abs(c[1] - n[1]) <= width &&
+            std::abs(c[2] - n[2]) <= width) {
+          covered = true;
+          break;
+        }
+      }
+      if (covered) {
+        expected.push_back(c);
+      }
+    }
+
+    EXPECT_EQ(cells_of(detail::clip_to_neighbourhood(candidate, near, width)), expected)
+        << "seed " << seed;
+  }
+}
+
+// ============================================================================
+// locate_cells
+// ============================================================================
+
+TEST(NeighbourhoodTest, LocateCellsInSuperMesh) {
+  // Super: row (0, 0) [0, 4) [10, 12), row (1, 0) [2, 5) -> 9 cells
+  const Mesh3DDevice super = make_mesh_device(
+      {{0, 0}, {1, 0}}, {0, 2, 3}, {{0, 4}, {10, 12}, {2, 5}});
+  const Mesh3DDevice sub = make_mesh_device(
+      {{0, 0}, {1, 0}}, {0, 1, 2}, {{11, 12}, {3, 5}});
+
+  Kokkos::View<std::size_t*, Kokkos::DefaultExecutionSpace::memory_space> super_offsets;
+  Kokkos::View<std::size_t*, Kokkos::DefaultExecutionSpace::memory_space> sub_offsets;
+  compute_interval_cell_offsets(super, super_offsets);
+  const std::size_t n = compute_interval_cell_offsets(sub, sub_offsets);
+  ASSERT_EQ(n, 3u);
+
+  Kokkos::View<std::size_t*, Kokkos::DefaultExecutionSpace::memory_space> out("out", n);
+  detail::locate_cells(sub, super, super_offsets, sub_offsets, out);
+  auto host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, out);
+  EXPECT_EQ(host(0), 5u);
+  EXPECT_EQ(host(1), 7u);
+  EXPECT_EQ(host(2), 8u);
+}
@@ -0,0 +1,176 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/ordering.hpp>
+#include <subsetix/intersection/v1.hpp>
+
+#include "test_utils/mesh_helpers.hpp"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+using namespace subsetix;
+using subsetix::intersection::v1::intersect_meshes;
+using subsetix::intersection::v1::mesh_to;
+using subsetix::test::expect_same_mesh;
+using subsetix::test::make_mesh_device;
+
+// ============================================================================
+// Test helpers
+// ============================================================================
+
+// n x n grid of rows; rows with (y + z) % skip == 0 are left out when skip > 0
+Mesh3DDevice make_grid_mesh(int n, int x_begin, int x_end, int skip = 0) {
+  std::vector<RowKey> keys;
+  std::vector<std::size_t> ptr = {0};
+  std::vector<Interval> iv;
+  for (int y = 0; y < n; ++y) {
+    for (int z = 0; z < n; ++z) {
+      if (skip > 0 && (y + z) % skip == 0) {
+        continue;
+      }
+      keys.push_back({y, z});
+      iv.push_back({x_begin + y, x_end + z});
+      ptr.push_back(iv.size());
+    }
+  }
+  return make_mesh_device(keys, ptr, iv);
+}
+
+std::vector<RowKey> stored_keys(const OrderedMesh3DDevice& m) {
+  const Mesh3DHost host = mesh_to<Kokkos::HostSpace>(m.mesh);
+  std::vector<RowKey> keys;
+  for (std::size_t i = 0; i < host.num_rows; ++i) {
+    keys.push_back(host.row_keys(i));
+  }
+  return keys;
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// Reordering
+// ============================================================================
+
+TEST(OrderingTest, MortonTilesKeepYNeighboursClose) {
+  // 4x4 rows, 2x2 tiles: tile (0,0) holds (0,0) (0,1) (1,0) (1,1)
+  const Mesh3DDevice mesh = make_grid_mesh(4, 0, 4);
+  RowOrdering ordering;
+  ordering.curve = CurveType::Morton;
+  ordering.block_bits = 1;
+  const auto ordered = reorder_rows(mesh, ordering);
+
+  const auto keys = stored_keys(ordered);
+  ASSERT_EQ(keys.size(), 16u);
+  EXPECT_EQ(keys[0], (RowKey{0, 0}));
+  EXPECT_EQ(keys[1], (RowKey{0, 1}));
+  EXPECT_EQ(keys[2], (RowKey{1, 0}));
+  EXPECT_EQ(keys[3], (RowKey{1, 1}));
+  EXPECT_EQ(keys[4], (RowKey{0, 2}));
+}
+
+TEST(OrderingTest, TilesAreAlignedOnZero) {
+  // Rows in [-2, 2)^2: the 2x2 tile of negative rows comes first, whole
+  std::vector<RowKey> keys_in;
+  std::vector<std::size_t> ptr = {0};
+  std::vector<Interval> iv;
+  for (Coord y = -2; y < 2; ++y) {
+    for (Coord z = -2; z < 2; ++z) {
+      keys_in.push_back({y, z});
+      iv.push_back({0, 1});
+      ptr.push_back(iv.size());
+    }
+  }
+  const auto ordered =
+      reorder_rows(make_mesh_device(keys_in, ptr, iv), RowOrdering{CurveType::Morton, 1});
+
+  const auto keys = stored_keys(ordered);
+  ASSERT_EQ(keys.size(), 16u);
+  EXPECT_EQ(keys[0], (RowKey{-2, -2}));
+  EXPECT_EQ(keys[1], (RowKey{-2, -1}));
+  EXPECT_EQ(keys[2], (RowKey{-1, -2}));
+  EXPECT_EQ(keys[3], (RowKey{-1, -1}));
+  EXPECT_EQ(keys[4], (RowKey{-2, 0}));
+}
+
+TEST(OrderingTest, PermutationsAreInverse) {
+  const Mesh3DDevice mesh = make_grid_mesh(8, -3, 5, 3);
+  const auto ordered = reorder_rows(mesh, RowOrdering{CurveType::Hilbert, 1});
+
+  auto to = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, ordered.to_canonical);
+  auto from = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, ordered.from_canonical);
+  const Mesh3DHost canonical = mesh_to<Kokkos::HostSpace>(mesh);
+  const auto keys = stored_keys(ordered);
+
+  ASSERT_EQ(to.extent(0), mesh.num_rows);
+  for (std::size_t i = 0; i < mesh.num_rows; ++i) {
+    EXPECT_EQ(from(to(i)), i);
+    EXPECT_EQ(keys[i], canonical.row_keys(to(i)));
+  }
+}
+
+TEST(OrderingTest, CanonicalizeRoundTrips) {
+  const Mesh3DDevice mesh = make_grid_mesh(7, 0, 3, 4);
+  for (const CurveType curve : {CurveType::Morton, CurveType::Hilbert}) {
+    for (const int bits : {0, 2}) {
+      const auto ordered = reorder_rows(mesh, RowOrdering{curve, bits});
+      expect_same_mesh(canonicalize(ordered), mesh);
+    }
+  }
+}
+
+// ============================================================================
+// Set operations on ordered meshes
+// ============================================================================
+
+TEST(OrderingTest, IntersectionMatchesCanonical) {
+  const Mesh3DDevice a = make_grid_mesh(9, 0, 6, 4);
+  const Mesh3DDevice b = make_grid_mesh(9, 3, 8, 5);
+  const Mesh3DDevice expected = intersect_meshes(a, b);
+
+  const auto oa = reorder_rows(a);
+  const auto ob = reorder_rows(b, RowOrdering{CurveType::Hilbert, 0});
+
+  const auto both_ordered = intersect_meshes(oa, ob);
+  expect_same_mesh(canonicalize(both_ordered), expected);
+
+  const auto mixed = intersect_meshes(oa, b);
+  expect_same_mesh(canonicalize(mixed), expected);
+
+  // The result is a sub-sequence of A's order, i.e. it is A's ordering again
+  const auto reordered = reorder_rows(expected);
+  expect_same_mesh(both_ordered.mesh, reordered.mesh);
+
+  // Permutations derived from A's match those of a fresh reordering
+  const auto to = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, mixed.to_canonical);
+  const auto from =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, mixed.from_canonical);
+  const auto to_ref =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, reordered.to_canonical);
+  ASSERT_EQ(to.extent(0), to_ref.extent(0));
+  for (std::size_t i = 0; i < to.extent(0); ++i) {
+    EXPECT_EQ(to(i), to_ref(i)) << "row " << i;
+    EXPECT_EQ(from(to(i)), i) << "row " << i;
+  }
+}
+
+TEST(OrderingTest, InvalidBlockBitsThrow) {
+  const Mesh3DDevice mesh = make_grid_mesh(2, 0, 1);
+  EXPECT_THROW(reorder_rows(mesh, RowOrdering{CurveType::Morton, -1}), std::invalid_argument);
+  EXPECT_THROW(reorder_rows(mesh, RowOrdering{CurveType::Hilbert, 32}), std::invalid_argument);
+  EXPECT_THROW(reorder_rows(Mesh3DDevice{}, RowOrdering{CurveType::Morton, 40}),
+               std::invalid_argument);
+  EXPECT_EQ(reorder_rows(mesh, RowOrdering{CurveType::Hilbert, 31}).mesh.num_rows, 4u);
+}
+
+TEST(OrderingTest, EmptyMesh) {
+  const auto ordered = reorder_rows(Mesh3DDevice{});
+  EXPECT_EQ(ordered.mesh.num_rows, 0u);
+  EXPECT_EQ(canonicalize(ordered).num_rows, 0u);
+  EXPECT_EQ(intersect_meshes(ordered, ordered).mesh.num_rows, 0u);
+}
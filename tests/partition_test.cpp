@@ -0,0 +1,157 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/field.hpp>
+#include <subsetix/partition.hpp>
+#include <subsetix/intersection/v1.hpp>
+
+#include "test_utils/mesh_helpers.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+using namespace subsetix;
+using subsetix::intersection::v1::mesh_to;
+using subsetix::test::make_mesh_device;
+
+using DeviceSpace = Kokkos::DefaultExecutionSpace::memory_space;
+
+// ============================================================================
+// Test helpers
+// ============================================================================
+
+// Full n x n grid of rows; row (y, z) holds `width(y, z)` cells starting at 0
+template <class WidthFn>
+Mesh3DDevice make_grid_mesh(int n, WidthFn width) {
+  std::vector<RowKey> keys;
+  std::vector<std::size_t> ptr = {0};
+  std::vector<Interval> iv;
+  for (int y = 0; y < n; ++y) {
+    for (int z = 0; z < n; ++z) {
+      keys.push_back({y, z});
+      iv.push_back({0, width(y, z)});
+      ptr.push_back(iv.size());
+    }
+  }
+  return make_mesh_device(keys, ptr, iv);
+}
+
+std::vector<std::size_t> order_to_host(const MeshPartition<DeviceSpace>& p) {
+  auto host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, p.order);
+  return std::vector<std::size_t>(host.data(), host.data() + host.extent(0));
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// Curve ordering
+// ============================================================================
+
+TEST(PartitionTest, HilbertOrderVisitsFaceNeighbours) {
+  const int n = 8;
+  const Mesh3DDevice mesh = make_grid_mesh(n, [](int, int) { return 1; });
+  const auto part = partition(mesh, 1, CurveType::Hilbert);
+  const auto order = order_to_host(part);
+  const Mesh3DHost host = mesh_to<Kokkos::HostSpace>(mesh);
+
+  ASSERT_EQ(order.size(), static_cast<std::size_t>(n * n));
+  for (std::size_t i = 1; i < order.size(); ++i) {
+    const RowKey a = host.row_keys(order[i - 1]);
+    const RowKey b = host.row_keys(order[i]);
+    EXPECT_EQ(std::abs(a.y - b.y) + std::abs(a.z - b.z), 1) << "step " << i;
+  }
+}
+
+TEST(PartitionTest, MortonOrderIsZCurve) {
+  const Mesh3DDevice mesh = make_grid_mesh(2, [](int, int) { return 1; });
+  const auto order = order_to_host(partition(mesh, 1, CurveType::Morton));
+  // Rows (0,0) (0,1) (1,0) (1,1): z is the fast (low bit) coordinate
+  EXPECT_EQ(order, (std::vector<std::size_t>{0, 1, 2, 3}));
+}
+
+TEST(PartitionTest, OrderIsPermutation) {
+  const Mesh3DDevice mesh = make_mesh_device(
+      {{-5, 3}, {-5, 4}, {0, -2}, {7, 7}, {9, -100}},
+      {0, 1, 2, 3, 4, 5},
+      {{0, 1}, {0, 1}, {0, 1}, {0, 1}, {0, 1}});
+  auto order = order_to_host(partition(mesh, 2, CurveType::Hilbert));
+  std::sort(order.begin(), order.end());
+  EXPECT_EQ(order, (std::vector<std::size_t>{0, 1, 2, 3, 4}));
+}
+
+// ============================================================================
+// Load balance
+// ============================================================================
+
+TEST(PartitionTest, BalancesSkewedWeights) {
+  // Row weights grow with y: splitting by row index would be badly skewed
+  const int n = 16;
+  const Mesh3DDevice mesh = make_grid_mesh(n, [](int y, int z) { return 1 + y * y + z; });
+  const std::size_t total = count_cells(mesh);
+  const std::size_t max_row = 1 + (n - 1) * (n - 1) + (n - 1);
+
+  for (const CurveType curve : {CurveType::Morton, CurveType::Hilbert}) {
+    const std::size_t num_parts = 4;
+    const auto part = partition(mesh, num_parts, curve);
+
+    ASSERT_EQ(part.num_parts(), num_parts);
+    EXPECT_EQ(part.part_ptr.front(), 0u);
+    EXPECT_EQ(part.part_ptr.back(), static_cast<std::size_t>(n * n));
+    EXPECT_EQ(std::accumulate(part.part_cells.begin(), part.part_cells.end(), std::size_t(0)),
+              total);
+
+    const std::size_t ideal = total / num_parts;
+    for (std::size_t p = 0; p < num_parts; ++p) {
+      EXPECT_LE(part.part_ptr[p], part.part_ptr[p + 1]);
+      EXPECT_LE(part.part_cells[p], ideal + max_row) << "part " << p;
+      EXPECT_GE(part.part_cells[p] + max_row, ideal) << "part " << p;
+    }
+  }
+}
+
+TEST(PartitionTest, MorePartsThanRows) {
+  const Mesh3DDevice mesh = make_mesh_device({{0, 0}, {0, 1}}, {0, 1, 2}, {{0, 5}, {0, 5}});
+  const auto part = partition(mesh, 5);
+  EXPECT_EQ(part.part_ptr.back(), 2u);
+  EXPECT_EQ(std::accumulate(part.part_cells.begin(), part.part_cells.end(), std::size_t(0)), 10u);
+}
+
+TEST(PartitionTest, EmptyMeshAndInvalidParts) {
+  const auto part = partition(Mesh3DDevice{}, 3);
+  EXPECT_EQ(part.part_ptr, (std::vector<std::size_t>{0, 0, 0, 0}));
+  EXPECT_THROW(partition(Mesh3DDevice{}, 0), std::invalid_argument);
+}
+
+// ============================================================================
+// Part extraction
+// ============================================================================
+
+TEST(PartitionTest, ExtractedPartsReassembleMesh) {
+  const int n = 6;
+  const Mesh3DDevice mesh = make_grid_mesh(n, [](int y, int z) { return 1 + (y + 2 * z) % 5; });
+  const auto part = partition(mesh, 3, CurveType::Hilbert);
+
+  std::size_t rows = 0;
+  std::size_t cells = 0;
+  for (std::size_t p = 0; p < part.num_parts(); ++p) {
+    const Mesh3DDevice sub = extract_part(mesh, part, p);
+    const Mesh3DHost host = mesh_to<Kokkos::HostSpace>(sub);
+    EXPECT_EQ(sub.num_rows, part.part_ptr[p + 1] - part.part_ptr[p]);
+    EXPECT_EQ(count_cells(sub), part.part_cells[p]);
+    for (std::size_t i = 1; i < host.num_rows; ++i) {
+      EXPECT_TRUE(host.row_keys(i - 1) < host.row_keys(i)) << "part " << p << " row " << i;
+    }
+    rows += sub.num_rows;
+    cells += count_cells(sub);
+  }
+  EXPECT_EQ(rows, mesh.num_rows);
+  EXPECT_EQ(cells, count_cells(mesh));
+}
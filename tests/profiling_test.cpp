@@ -0,0 +1,216 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/profiling.hpp>
+#include <subsetix/intersection/v1.hpp>
+
+#include "test_utils/mesh_helpers.hpp"
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <vector>
+
+namespace {
+
+using namespace subsetix;
+using subsetix::intersection::v1::intersect_inplace;
+using subsetix::intersection::v1::intersect_meshes;
+using subsetix::profiling::Collector;
+using subsetix::test::make_mesh_device;
+
+// Enables the collector for one test and restores the previous state
+class ProfilingTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    if (!profiling::collector_available) {
+      GTEST_SKIP() << "built without SUBSETIX_ENABLE_PROFILING";
+    }
+    Collector::instance().reset();
+    Collector::instance().enable();
+  }
+
+  void TearDown() override {
+    Collector::instance().disable();
+    Collector::instance().reset();
+  }
+};
+
+// Two rows in A, one of which is absent from B; the shared row leaves one
+// row empty after intersection so that every phase, compaction included, runs
+Mesh3DDevice make_a() {
+  return make_mesh_device({{0, 0}, {1, 0}, {2, 0}}, {0, 1, 2, 3},
+                          {{0, 4}, {0, 4}, {0, 4}});
+}
+
+Mesh3DDevice make_b() {
+  return make_mesh_device({{0, 0}, {1, 0}}, {0, 1, 2}, {{2, 6}, {8, 9}});
+}
+
+} // anonymous namespace
+
+TEST_F(ProfilingTest, RecordsEveryPhase) {
+  const Mesh3DDevice result = intersect_meshes(make_a(), make_b());
+  EXPECT_EQ(result.num_rows, 1u);
+  EXPECT_EQ(Collector::instance().depth(), 0u);
+
+  const auto& phases = Collector::instance().phases();
+  for (const char* phase : {"intersect_meshes", "intersect_meshes/row_map",
+                            "intersect_meshes/row_scan", "intersect_meshes/row_compact",
+                            "intersect_meshes/count", "intersect_meshes/scan",
+                            "intersect_meshes/fill", "intersect_meshes/mark",
+                            "intersect_meshes/compact_copy"}) {
+    const auto it = phases.find(phase);
+    ASSERT_NE(it, phases.end()) << phase;
+    EXPECT_EQ(it->second.calls, 1u) << phase;
+    EXPECT_GE(it->second.seconds, 0.0) << phase;
+  }
+
+  EXPECT_GE(phases.at("intersect_meshes/count").kernel_launches, 1u);
+  EXPECT_GT(phases.at("intersect_meshes/row_map").bytes_allocated, 0u);
+
+  // Nested phases are included in the operation totals
+  std::size_t launches = 0;
+  for (const auto& [path, stats] : phases) {
+    if (path != "intersect_meshes") {
+      launches += stats.kernel_launches;
+    }
+  }
+  EXPECT_GE(phases.at("intersect_meshes").kernel_launches, launches);
+}
+
+TEST_F(ProfilingTest, EarlyReturnKeepsRegionsBalanced) {
+  const Mesh3DDevice a = make_a();
+  const Mesh3DDevice disjoint = make_mesh_device({{7, 7}}, {0, 1}, {{0, 4}});
+
+  intersect_meshes(a, Mesh3DDevice{});
+  intersect_meshes(a, disjoint);
+  EXPECT_EQ(Collector::instance().depth(), 0u);
+
+  const auto& phases = Collector::instance().phases();
+  EXPECT_EQ(phases.at("intersect_meshes").calls, 2u);
+  EXPECT_EQ(phases.at("intersect_meshes/row_scan").calls, 1u);
+  EXPECT_EQ(phases.count("intersect_meshes/count"), 0u);
+}
+
+TEST_F(ProfilingTest, ReportListsPhases) {
+  intersect_meshes(make_a(), make_b());
+
+  std::ostringstream os;
+  Collector::instance().report(os);
+  EXPECT_NE(os.str().find("intersect_meshes/fill"), std::string::npos);
+}
+
+// ============================================================================
+// Allocation tracking (always compiled in)
+// ============================================================================
+
+namespace {
+
+class AllocationTrackerTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    profiling::AllocationTracker::instance().reset();
+    profiling::AllocationTracker::instance().enable();
+  }
+
+  void TearDown() override {
+    profiling::AllocationTracker::instance().disable();
+    profiling::AllocationTracker::instance().reset();
+  }
+};
+
+} // anonymous namespace
+
+TEST_F(AllocationTrackerTest, RecordsAllocationsAndLifetimes) {
+  auto& tracker = profiling::AllocationTracker::instance();
+  {
+    Kokkos::View<int*> view("tracked_view", 256);
+    EXPECT_GE(tracker.current_bytes(), 256 * sizeof(int));
+  }
+  EXPECT_EQ(tracker.current_bytes(), 0u);
+  EXPECT_GE(tracker.peak_bytes(), 256 * sizeof(int));
+
+  ASSERT_EQ(tracker.allocations().size(), 1u);
+  const profiling::AllocationRecord& r = tracker.allocations().front();
+  EXPECT_EQ(r.label, "tracked_view");
+  EXPECT_EQ(r.bytes, tracker.peak_bytes());
+  EXPECT_TRUE(r.operation.empty());
+  EXPECT_GE(r.lifetime_seconds, 0.0);
+}
+
+TEST_F(AllocationTrackerTest, PeakPerOperation) {
+  const Mesh3DDevice a = make_a();
+  const Mesh3DDevice b = make_b();
+  auto& tracker = profiling::AllocationTracker::instance();
+  tracker.reset();  // forget the inputs
+  const std::size_t before = tracker.current_bytes();
+
+  {
+    const Mesh3DDevice result = intersect_meshes(a, b);
+    ASSERT_EQ(result.num_rows, 1u);
+
+    const auto& ops = tracker.operations();
+    ASSERT_EQ(ops.count("intersect_meshes"), 1u);
+    const profiling::OperationMemory& m = ops.at("intersect_meshes");
+    EXPECT_EQ(m.calls, 1u);
+    EXPECT_GT(m.allocations, 5u);
+    EXPECT_GE(m.bytes_allocated, m.peak_bytes);
+
+    // The peak covers the result, which is still alive
+    const std::size_t result_bytes = result.row_keys.span() * sizeof(RowKey) +
+                                     result.row_ptr.span() * sizeof(std::size_t) +
+                                     result.intervals.span() * sizeof(Interval);
+    EXPECT_GE(m.peak_bytes, result_bytes);
+    EXPECT_GT(tracker.current_bytes(), before);
+  }
+
+  // Temporaries and the result are all released
+  EXPECT_EQ(tracker.current_bytes(), before);
+  for (const auto& r : tracker.allocations()) {
+    EXPECT_EQ(r.operation, "intersect_meshes") << r.label;
+    EXPECT_GE(r.lifetime_seconds, 0.0) << r.label;
+  }
+}
+
+TEST_F(AllocationTrackerTest, InplaceAvoidsTheResultAllocation) {
+  // A masked by a B that keeps most of it: the result is nearly as large as A
+  std::vector<RowKey> keys;
+  std::vector<std::size_t> ptr_a = {0};
+  std::vector<std::size_t> ptr_b = {0};
+  std::vector<Interval> intervals_a;
+  std::vector<Interval> intervals_b;
+  for (Coord y = 0; y < 512; ++y) {
+    keys.push_back({y, 0});
+    for (Coord x = 0; x < 64; x += 4) {
+      intervals_a.push_back({x, x + 3});
+    }
+    intervals_b.push_back({1, 60});
+    ptr_a.push_back(intervals_a.size());
+    ptr_b.push_back(intervals_b.size());
+  }
+  Mesh3DDevice a = make_mesh_device(keys, ptr_a, intervals_a);
+  const Mesh3DDevice b = make_mesh_device(keys, ptr_b, intervals_b);
+
+  auto& tracker = profiling::AllocationTracker::instance();
+  tracker.reset();  // forget the inputs
+  intersect_meshes(a, b);
+  intersect_inplace(a, b);
+  ASSERT_EQ(a.num_rows, 512u);
+
+  const auto& ops = tracker.operations();
+  ASSERT_EQ(ops.count("intersect_inplace"), 1u);
+  // Per-row metadata and about one block of scratch, against a result
+  // allocation of |A| + |B| intervals
+  EXPECT_LT(2 * ops.at("intersect_inplace").peak_bytes, ops.at("intersect_meshes").peak_bytes);
+}
+
+TEST_F(AllocationTrackerTest, ReportListsOperations) {
+  intersect_meshes(make_a(), make_b());
+
+  std::ostringstream os;
+  profiling::AllocationTracker::instance().report(os);
+  EXPECT_NE(os.str().find("intersect_meshes"), std::string::npos);
+  EXPECT_GT(profiling::AllocationTracker::instance().max_operation_peak(), 0u);
+}
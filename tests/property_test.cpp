@@ -0,0 +1,158 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/reference.hpp>
+#include <subsetix/complement.hpp>
+#include <subsetix/intersection/v1.hpp>
+
+#include "test_utils/random_mesh.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+namespace {
+
+using namespace subsetix;
+using subsetix::intersection::v1::intersect_meshes;
+using subsetix::test::RandomMeshParams;
+using subsetix::test::random_rows;
+namespace ref = subsetix::reference;
+
+// ============================================================================
+// Harness
+// ============================================================================
+
+constexpr int trials_per_window = 25;
+
+std::vector<RandomMeshParams> windows() {
+  return {test::params_small(), test::params_low_extreme(), test::params_high_extreme(),
+          test::params_full_range()};
+}
+
+// Device intersection of host rows, read back as rows
+ref::Rows device_intersect(const ref::Rows& a, const ref::Rows& b) {
+  return ref::to_rows(intersect_meshes(ref::to_mesh(a), ref::to_mesh(b)));
+}
+
+// Run law(rng, params, trial) over every window with a seed per law
+template <class Law>
+void for_all(unsigned seed, const Law& law) {
+  std::mt19937 rng(seed);
+  for (const RandomMeshParams& p : windows()) {
+    for (int trial = 0; trial < trials_per_window; ++trial) {
+      law(rng, p, trial);
+    }
+  }
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// Algebraic laws of the device intersection
+// ============================================================================
+
+TEST(PropertyTest, MatchesReference) {
+  for_all(1, [](std::mt19937& rng, const RandomMeshParams& p, int trial) {
+    const ref::Rows a = random_rows(rng, p);
+    const ref::Rows b = random_rows(rng, p);
+    EXPECT_TRUE(ref::same_rows(device_intersect(a, b), ref::intersect(a, b)))
+        << "x in [" << p.x_lo << ", " << p.x_hi << "], trial " << trial;
+  });
+}
+
+TEST(PropertyTest, Commutativity) {
+  for_all(2, [](std::mt19937& rng, const RandomMeshParams& p, int trial) {
+    const ref::Rows a = random_rows(rng, p);
+    const ref::Rows b = random_rows(rng, p);
+    EXPECT_TRUE(ref::same_rows(device_intersect(a, b), device_intersect(b, a)))
+        << "trial " << trial;
+  });
+}
+
+TEST(PropertyTest, Associativity) {
+  for_all(3, [](std::mt19937& rng, const RandomMeshParams& p, int trial) {
+    const Mesh3DDevice a = ref::to_mesh(random_rows(rng, p));
+    const Mesh3DDevice b = ref::to_mesh(random_rows(rng, p));
+    const Mesh3DDevice c = ref::to_mesh(random_rows(rng, p));
+    EXPECT_TRUE(ref::same_rows(ref::to_rows(intersect_meshes(intersect_meshes(a, b), c)),
+                               ref::to_rows(intersect_meshes(a, intersect_meshes(b, c)))))
+        << "trial " << trial;
+  });
+}
+
+TEST(PropertyTest, Idempotency) {
+  for_all(4, [](std::mt19937& rng, const RandomMeshParams& p, int trial) {
+    const ref::Rows a = random_rows(rng, p);
+    EXPECT_TRUE(ref::same_rows(device_intersect(a, a), a)) << "trial " << trial;
+  });
+}
+
+// A ∩ (B ∪ C) = (A ∩ B) ∪ (A ∩ C); unions are taken on the host
+TEST(PropertyTest, Distributivity) {
+  for_all(5, [](std::mt19937& rng, const RandomMeshParams& p, int trial) {
+    const ref::Rows a = random_rows(rng, p);
+    const ref::Rows b = random_rows(rng, p);
+    const ref::Rows c = random_rows(rng, p);
+    EXPECT_TRUE(ref::same_rows(device_intersect(a, ref::unite(b, c)),
+                               ref::unite(device_intersect(a, b), device_intersect(a, c))))
+        << "trial " << trial;
+  });
+}
+
+// box \ (A ∩ B) = (box \ A) ∪ (box \ B), box the bounding box of A ∪ B
+TEST(PropertyTest, DeMorgan) {
+  for_all(6, [](std::mt19937& rng, const RandomMeshParams& p, int trial) {
+    const ref::Rows a = random_rows(rng, p);
+    const ref::Rows b = random_rows(rng, p);
+    const CellBox box = ref::bounding_box(ref::unite(a, b));
+    EXPECT_TRUE(ref::same_rows(ref::complement(device_intersect(a, b), box),
+                               ref::unite(ref::complement(a, box), ref::complement(b, box))))
+        << "trial " << trial;
+  });
+}
+
+// Same law with the device complement: box \ (A ∩ B) = (box \ A) ∪ (box \ B)
+TEST(PropertyTest, DeMorganOnDevice) {
+  for_all(8, [](std::mt19937& rng, const RandomMeshParams& p, int trial) {
+    const Mesh3DDevice a = ref::to_mesh(random_rows(rng, p));
+    const Mesh3DDevice b = ref::to_mesh(random_rows(rng, p));
+    const CellBox box = ref::bounding_box(ref::unite(ref::to_rows(a), ref::to_rows(b)));
+    EXPECT_TRUE(ref::same_rows(ref::to_rows(complement(intersect_meshes(a, b), box)),
+                               ref::unite(ref::to_rows(complement(a, box)),
+                                          ref::to_rows(complement(b, box)))))
+        << "trial " << trial;
+  });
+}
+
+// box \ (box \ A) = A, box the bounding box of A
+TEST(PropertyTest, ComplementInvolution) {
+  for_all(9, [](std::mt19937& rng, const RandomMeshParams& p, int trial) {
+    const ref::Rows a = random_rows(rng, p);
+    const CellBox box = ref::bounding_box(a);
+    EXPECT_TRUE(ref::same_rows(ref::to_rows(complement(complement(ref::to_mesh(a), box), box)), a))
+        << "trial " << trial;
+  });
+}
+
+// ============================================================================
+// At scale: large random meshes against the reference
+// ============================================================================
+
+TEST(PropertyTest, LargeMeshesMatchReference) {
+  std::mt19937 rng(7);
+  RandomMeshParams p;
+  p.row_span = 160;
+  p.row_fill = 0.7;
+  p.x_lo = -100000;
+  p.x_hi = 100000;
+  p.max_intervals = 32;
+  for (int trial = 0; trial < 3; ++trial) {
+    const ref::Rows a = random_rows(rng, p);
+    const ref::Rows b = random_rows(rng, p);
+    EXPECT_TRUE(ref::same_rows(device_intersect(a, b), ref::intersect(a, b)))
+        << "trial " << trial;
+  }
+}
@@ -0,0 +1,202 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/raycast.hpp>
+#include <subsetix/reference.hpp>
+
+#include "test_utils/random_mesh.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace subsetix;
+namespace ref = subsetix::reference;
+
+Ray make_ray(double ox, double oy, double oz, double dx, double dy, double dz,
+             double t_max = INFINITY) {
+  Ray ray;
+  ray.origin[0] = ox;
+  ray.origin[1] = oy;
+  ray.origin[2] = oz;
+  ray.direction[0] = dx;
+  ray.direction[1] = dy;
+  ray.direction[2] = dz;
+  ray.t_max = t_max;
+  return ray;
+}
+
+// Device hits on the host
+std::vector<RayHit> device_hits(const ref::Rows& rows, const std::vector<Ray>& rays) {
+  using MemorySpace = Kokkos::DefaultExecutionSpace::memory_space;
+  Kokkos::View<Ray*, MemorySpace> d_rays("rays", rays.size());
+  auto h_rays = Kokkos::create_mirror_view(d_rays);
+  for (std::size_t i = 0; i < rays.size(); ++i) {
+    h_rays(i) = rays[i];
+  }
+  Kokkos::deep_copy(d_rays, h_rays);
+
+  const auto hits = raycast(ref::to_mesh(rows), d_rays);
+  auto h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), hits);
+  return std::vector<RayHit>(h.data(), h.data() + h.extent(0));
+}
+
+void expect_hit(const RayHit& got, const RayHit& expected) {
+  ASSERT_EQ(got.hit, expected.hit);
+  if (!expected.hit) {
+    return;
+  }
+  EXPECT_EQ(got.cell[0], expected.cell[0]);
+  EXPECT_EQ(got.cell[1], expected.cell[1]);
+  EXPECT_EQ(got.cell[2], expected.cell[2]);
+  EXPECT_NEAR(got.t, expected.t, 1e-9 * (1.0 + expected.t));
+  EXPECT_EQ(got.interval, expected.interval);
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// Small hand-built cases
+// ============================================================================
+
+TEST(RaycastTest, EmptyMeshAndNoRays) {
+  const auto hits = device_hits({}, {make_ray(0.5, 0.5, 0.5, 1, 0, 0)});
+  ASSERT_EQ(hits.size(), 1u);
+  EXPECT_FALSE(hits[0].hit);
+
+  EXPECT_TRUE(device_hits({{{0, 0}, {{0, 4}}}}, {}).empty());
+}
+
+TEST(RaycastTest, AxisAlignedRays) {
+  const ref::Rows rows = {{{0, 0}, {{2, 4}, {8, 9}}}, {{1, 0}, {{-5, -3}}}};
+  const auto hits = device_hits(
+      rows, {make_ray(0.5, 0.5, 0.5, 1, 0, 0),      // enters [2, 4) at x = 2
+             make_ray(5.5, 0.5, 0.5, 1, 0, 0),      // skips to [8, 9)
+             make_ray(5.5, 0.5, 0.5, -2, 0, 0),     // backwards into cell 3
+             make_ray(3.5, 0.5, 0.5, 1, 0, 0),      // starts inside
+             make_ray(0.5, 1.5, 0.5, 1, 0, 0),      // row (1, 0) is behind it
+             make_ray(0.5, 0.5, 0.5, 1, 0, 0, 1.0), // stops before x = 2
+             make_ray(2.5, 5.5, 0.5, 0, -1, 0)});   // down y into row (0, 0)
+
+  ASSERT_EQ(hits.size(), 7u);
+  EXPECT_TRUE(hits[0].hit);
+  EXPECT_EQ(hits[0].cell[0], 2);
+  EXPECT_DOUBLE_EQ(hits[0].t, 1.5);
+  EXPECT_EQ(hits[0].interval, 0u);
+
+  EXPECT_EQ(hits[1].cell[0], 8);
+  EXPECT_DOUBLE_EQ(hits[1].t, 2.5);
+  EXPECT_EQ(hits[1].interval, 1u);
+
+  EXPECT_EQ(hits[2].cell[0], 3);
+  EXPECT_DOUBLE_EQ(hits[2].t, 0.75);
+
+  EXPECT_EQ(hits[3].cell[0], 3);
+  EXPECT_DOUBLE_EQ(hits[3].t, 0.0);
+
+  EXPECT_FALSE(hits[4].hit);
+  EXPECT_FALSE(hits[5].hit);
+
+  EXPECT_TRUE(hits[6].hit);
+  EXPECT_EQ(hits[6].cell[1], 0);
+  EXPECT_DOUBLE_EQ(hits[6].t, 4.5);
+}
+
+TEST(RaycastTest, ObliqueRayCrossesEmptyPlanes) {
+  // Rows far apart in y: the ray crosses empty planes in single steps
+  const ref::Rows rows = {{{-20, 3}, {{0, 1}}}, {{40, 12}, {{0, 100}}}};
+  const Ray ray = make_ray(0.5, -30.5, 0.5, 0, 1, 12.0 / 71.0);
+  const auto hits = device_hits(rows, {ray});
+  expect_hit(hits[0], ref::raycast(rows, ray));
+  EXPECT_TRUE(hits[0].hit);
+  EXPECT_EQ(hits[0].cell[1], 40);
+}
+
+TEST(RaycastTest, RayJumpsBetweenStoredColumnsOfAPlane) {
+  // Rows far apart in z within the same planes: the ray jumps from column to
+  // column, and leaves plane 0 in the middle of a gap
+  const ref::Rows rows = {{{0, -50}, {{0, 1}}},
+                          {{0, 50}, {{5, 6}}},
+                          {{1, 20}, {{-10, 10}}},
+                          {{1, 60}, {{0, 100}}}};
+  const std::vector<Ray> rays = {
+      make_ray(5.5, 0.5, -60.5, 0, 0, 1),
+      make_ray(0.5, 0.25, -60.5, 0, 1.0 / 110.0, 1),
+      make_ray(0.5, 0.5, 70.5, 0, 0.01, -1),
+  };
+  const auto hits = device_hits(rows, rays);
+  for (std::size_t i = 0; i < rays.size(); ++i) {
+    expect_hit(hits[i], ref::raycast(rows, rays[i]));
+  }
+  EXPECT_EQ(hits[0].cell[2], 50);
+  EXPECT_EQ(hits[1].cell[2], -50);
+  EXPECT_EQ(hits[2].cell[1], 1);
+  EXPECT_EQ(hits[2].cell[2], 20);
+}
+
+TEST(RaycastTest, GrazingRaysMiss) {
+  const ref::Rows rows = {{{0, 0}, {{0, 1}}}};
+  const auto hits = device_hits(rows, {make_ray(-1, 1, 0.5, 1, 0, 0),     // along a face
+                                       make_ray(0, -1, 0.5, 1, 1, 0),     // through a corner
+                                       make_ray(-1, -1, -1, 1, 1, 1),     // along the diagonal
+                                       make_ray(-1, 0.5, 0.5, 1, 0, 0)});
+  EXPECT_FALSE(hits[0].hit);
+  EXPECT_FALSE(hits[1].hit);
+  EXPECT_TRUE(hits[2].hit);
+  EXPECT_DOUBLE_EQ(hits[2].t, 1.0);
+  EXPECT_TRUE(hits[3].hit);
+  EXPECT_DOUBLE_EQ(hits[3].t, 1.0);
+}
+
+// ============================================================================
+// Random meshes against the reference
+// ============================================================================
+
+TEST(RaycastTest, MatchesReference) {
+  std::mt19937 rng(31);
+  const test::RandomMeshParams p = test::params_small();
+  for (int trial = 0; trial < 10; ++trial) {
+    const ref::Rows rows = test::random_rows(rng, p);
+    const CellBox box = ref::bounding_box(rows);
+    if (box.empty()) {
+      continue;
+    }
+    // Rays from around the bounding box, some on the cell lattice
+    std::uniform_real_distribution<double> dir(-3.0, 3.0);
+    std::vector<Ray> rays;
+    for (int i = 0; i < 200; ++i) {
+      Ray ray;
+      for (int a = 0; a < 3; ++a) {
+        std::uniform_real_distribution<double> pos(box.lo[a] - 3.0, box.hi[a] + 3.0);
+        ray.origin[a] = pos(rng);
+        ray.direction[a] = dir(rng);
+        if (i % 4 == 0) {
+          ray.origin[a] = std::round(2.0 * ray.origin[a]) / 2.0;
+          ray.direction[a] = std::round(ray.direction[a]);
+        }
+      }
+      if (i % 5 == 0) {
+        ray.direction[1] = ray.direction[2] = 0.0;
+      } else if (i % 5 == 1) {
+        ray.direction[rng() % 3] = 0.0;
+      }
+      if (i % 3 == 0) {
+        ray.t_max = std::abs(dir(rng));
+      }
+      rays.push_back(ray);
+    }
+
+    const auto hits = device_hits(rows, rays);
+    ASSERT_EQ(hits.size(), rays.size());
+    for (std::size_t i = 0; i < rays.size(); ++i) {
+      SCOPED_TRACE("trial " + std::to_string(trial) + " ray " + std::to_string(i));
+      expect_hit(hits[i], ref::raycast(rows, rays[i]));
+    }
+  }
+}
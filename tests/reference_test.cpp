@@ -0,0 +1,97 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/reference.hpp>
+#include <subsetix/intersection/v1.hpp>
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+namespace {
+
+using namespace subsetix;
+using subsetix::intersection::v1::intersect_inplace;
+using subsetix::intersection::v1::intersect_meshes;
+namespace ref = subsetix::reference;
+
+// Random canonical rows in [0, 8) x [0, 8); intervals in [0, 64)
+ref::Rows random_rows(std::mt19937& rng) {
+  ref::Rows rows;
+  for (Coord y = 0; y < 8; ++y) {
+    for (Coord z = 0; z < 8; ++z) {
+      if (rng() % 2 == 0) {
+        continue;
+      }
+      ref::RowIntervals row;
+      Coord x = static_cast<Coord>(rng() % 8);
+      while (x < 64) {
+        const Coord end = x + 1 + static_cast<Coord>(rng() % 8);
+        row.push_back({x, end < 64 ? end : 64});
+        x = end + 1 + static_cast<Coord>(rng() % 8);
+      }
+      rows.emplace(RowKey{y, z}, std::move(row));
+    }
+  }
+  return rows;
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// Row operations
+// ============================================================================
+
+TEST(ReferenceTest, RowOperations) {
+  const ref::RowIntervals a = {{0, 4}, {6, 10}};
+  const ref::RowIntervals b = {{2, 7}, {9, 12}};
+
+  const ref::Rows i = {{{0, 0}, ref::intersect_row(a, b)}};
+  const ref::Rows u = {{{0, 0}, ref::unite_row(a, b)}};
+  const ref::Rows d = {{{0, 0}, ref::subtract_row(a, b)}};
+
+  EXPECT_TRUE(ref::same_rows(i, {{{0, 0}, {{2, 4}, {6, 7}, {9, 10}}}}));
+  EXPECT_TRUE(ref::same_rows(u, {{{0, 0}, {{0, 12}}}}));
+  EXPECT_TRUE(ref::same_rows(d, {{{0, 0}, {{0, 2}, {7, 9}}}}));
+}
+
+TEST(ReferenceTest, MeshRoundTrip) {
+  std::mt19937 rng(7);
+  const ref::Rows rows = random_rows(rng);
+  EXPECT_TRUE(ref::same_rows(ref::to_rows(ref::to_mesh(rows)), rows));
+  EXPECT_EQ(ref::to_mesh(ref::Rows{}).num_rows, 0u);
+}
+
+TEST(ReferenceTest, SetAlgebra) {
+  std::mt19937 rng(11);
+  const ref::Rows a = random_rows(rng);
+  const ref::Rows b = random_rows(rng);
+
+  // |A ∪ B| = |A| + |B| - |A ∩ B| and (A \ B) ∪ (A ∩ B) = A
+  EXPECT_EQ(ref::count_cells(ref::unite(a, b)),
+            ref::count_cells(a) + ref::count_cells(b) - ref::count_cells(ref::intersect(a, b)));
+  EXPECT_TRUE(ref::same_rows(ref::unite(ref::subtract(a, b), ref::intersect(a, b)), a));
+}
+
+// ============================================================================
+// Differential tests: device kernels against the reference
+// ============================================================================
+
+TEST(ReferenceTest, IntersectMatchesReference) {
+  std::mt19937 rng(2025);
+  for (int trial = 0; trial < 50; ++trial) {
+    const ref::Rows a = random_rows(rng);
+    const ref::Rows b = random_rows(rng);
+    const ref::Rows expected = ref::intersect(a, b);
+
+    const Mesh3DDevice da = ref::to_mesh(a);
+    const Mesh3DDevice db = ref::to_mesh(b);
+    EXPECT_TRUE(ref::same_rows(ref::to_rows(intersect_meshes(da, db)), expected))
+        << "trial " << trial;
+
+    Mesh3DDevice inplace = ref::to_mesh(a);
+    intersect_inplace(inplace, db);
+    EXPECT_TRUE(ref::same_rows(ref::to_rows(inplace), expected)) << "trial " << trial;
+  }
+}
@@ -0,0 +1,90 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/intersection/v1.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace subsetix::test {
+
+// ============================================================================
+// Mesh construction helpers (host data -> device mesh)
+// ============================================================================
+
+// Build a device mesh from host CSR arrays
+inline Mesh3DDevice make_mesh_device(
+    const std::vector<RowKey>& row_keys_vec,
+    const std::vector<std::size_t>& row_ptr_vec,
+    const std::vector<Interval>& intervals_vec) {
+
+  Mesh3DHost host;
+  const std::size_t nrows = row_keys_vec.size();
+  const std::size_t nints = intervals_vec.size();
+
+  if (nrows == 0) {
+    return Mesh3DDevice{};
+  }
+
+  host.row_keys = Mesh3DHost::RowKeyView("test_row_keys", nrows);
+  host.row_ptr = Mesh3DHost::IndexView("test_row_ptr", nrows + 1);
+  host.intervals = Mesh3DHost::IntervalView("test_intervals", nints);
+
+  host.num_rows = nrows;
+  host.num_intervals = nints;
+
+  for (std::size_t i = 0; i < nrows; ++i) {
+    host.row_keys(i) = row_keys_vec[i];
+    host.row_ptr(i) = row_ptr_vec[i];
+  }
+  host.row_ptr(nrows) = row_ptr_vec[nrows];
+
+  for (std::size_t i = 0; i < nints; ++i) {
+    host.intervals(i) = intervals_vec[i];
+  }
+
+  return intersection::v1::mesh_to<Kokkos::DefaultExecutionSpace::memory_space>(host);
+}
+
+// Copy host values into a device view of the same extent
+template <class T, class ViewType>
+void copy_to_view(const std::vector<T>& values, const ViewType& view) {
+  auto host = Kokkos::create_mirror_view(view);
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    host(i) = values[i];
+  }
+  Kokkos::deep_copy(view, host);
+}
+
+// ============================================================================
+// Mesh comparison
+// ============================================================================
+
+// Compare two meshes on the host, ignoring capacity beyond num_intervals.
+// Either side may live in any memory space.
+template <class ActualSpace, class ExpectedSpace>
+void expect_same_mesh(const Mesh3D<ActualSpace>& actual, const Mesh3D<ExpectedSpace>& expected) {
+  const Mesh3DHost a = intersection::v1::mesh_to<Kokkos::HostSpace>(actual);
+  const Mesh3DHost e = intersection::v1::mesh_to<Kokkos::HostSpace>(expected);
+  ASSERT_EQ(a.num_rows, e.num_rows);
+  ASSERT_EQ(a.num_intervals, e.num_intervals);
+  if (a.num_rows > 0) {
+    EXPECT_EQ(a.row_ptr(0), e.row_ptr(0));
+  }
+  for (std::size_t i = 0; i < a.num_rows; ++i) {
+    EXPECT_EQ(a.row_keys(i), e.row_keys(i)) << "row " << i;
+    EXPECT_EQ(a.row_ptr(i + 1), e.row_ptr(i + 1)) << "row_ptr " << i;
+  }
+  for (std::size_t k = 0; k < a.num_intervals; ++k) {
+    EXPECT_EQ(a.intervals(k).begin, e.intervals(k).begin) << "interval " << k;
+    EXPECT_EQ(a.intervals(k).end, e.intervals(k).end) << "interval " << k;
+  }
+}
+
+}  // namespace subsetix::test
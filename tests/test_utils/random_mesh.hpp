@@ -0,0 +1,122 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/reference.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace subsetix::test {
+
+// ============================================================================
+// Random canonical meshes (property tests and fuzzing)
+// ============================================================================
+
+constexpr Coord coord_min = std::numeric_limits<Coord>::min();
+constexpr Coord coord_max = std::numeric_limits<Coord>::max();
+
+/**
+ * @brief Where random rows and intervals are placed.
+ *
+ * Row keys are drawn from [row_lo, row_lo + row_span) on y and z; interval
+ * bounds from [x_lo, x_hi]. Keep row_lo + row_span below coord_max so that
+ * bounding boxes stay representable.
+ */
+struct RandomMeshParams {
+  Coord row_lo = 0;
+  Coord row_span = 8;
+  double row_fill = 0.5;  // probability that a candidate row is present
+  Coord x_lo = 0;
+  Coord x_hi = 64;
+  int max_intervals = 4;
+};
+
+// The windows property tests cycle through: small coordinates, then the
+// low and high ends of the int32 range on every axis
+inline RandomMeshParams params_small() {
+  return {};
+}
+
+inline RandomMeshParams params_low_extreme() {
+  return {coord_min, 6, 0.5, coord_min, coord_min + 200, 4};
+}
+
+inline RandomMeshParams params_high_extreme() {
+  return {coord_max - 7, 6, 0.5, coord_max - 200, coord_max, 4};
+}
+
+// Whole int32 range on x: intervals of up to 2^32 - 1 cells
+inline RandomMeshParams params_full_range() {
+  return {-3, 6, 0.5, coord_min, coord_max, 3};
+}
+
+/**
+ * @brief Row from 2k distinct sorted points: [p0, p1), [p2, p3), ...
+ *
+ * Points are distinct, so intervals are non-empty and never touch. The
+ * range ends are forced in now and then to hit the boundary values.
+ */
+template <class Rng>
+reference::RowIntervals random_row(Rng& rng, const RandomMeshParams& p) {
+  std::uniform_int_distribution<std::int64_t> coord(p.x_lo, p.x_hi);
+  std::uniform_int_distribution<int> count(1, p.max_intervals);
+  std::vector<std::int64_t> points(2 * static_cast<std::size_t>(count(rng)));
+  for (auto& x : points) {
+    x = coord(rng);
+  }
+  if (rng() % 4 == 0) {
+    points.front() = p.x_lo;
+  }
+  if (rng() % 4 == 0) {
+    points.back() = p.x_hi;
+  }
+  std::sort(points.begin(), points.end());
+  points.erase(std::unique(points.begin(), points.end()), points.end());
+
+  reference::RowIntervals row;
+  for (std::size_t k = 0; k + 1 < points.size(); k += 2) {
+    row.push_back({static_cast<Coord>(points[k]), static_cast<Coord>(points[k + 1])});
+  }
+  return row;
+}
+
+template <class Rng>
+reference::Rows random_rows(Rng& rng, const RandomMeshParams& p) {
+  std::bernoulli_distribution present(p.row_fill);
+  reference::Rows rows;
+  for (Coord dy = 0; dy < p.row_span; ++dy) {
+    for (Coord dz = 0; dz < p.row_span; ++dz) {
+      if (!present(rng)) {
+        continue;
+      }
+      reference::RowIntervals row = random_row(rng, p);
+      if (!row.empty()) {
+        rows.emplace(RowKey{p.row_lo + dy, p.row_lo + dz}, std::move(row));
+      }
+    }
+  }
+  return rows;
+}
+
+// ============================================================================
+// Fixed shapes
+// ============================================================================
+
+// n x n x n block of cells at the origin
+inline reference::Rows block(Coord n) {
+  reference::Rows rows;
+  for (Coord y = 0; y < n; ++y) {
+    for (Coord z = 0; z < n; ++z) {
+      rows[{y, z}] = {{0, n}};
+    }
+  }
+  return rows;
+}
+
+} // namespace subsetix::test
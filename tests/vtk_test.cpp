@@ -0,0 +1,215 @@
+// SPDX-FileCopyrightText: 2025 Subsetix Kokkos Contributors
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <subsetix/mesh.hpp>
+#include <subsetix/field.hpp>
+#include <subsetix/io/vtk.hpp>
+
+#include "test_utils/mesh_helpers.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace subsetix;
+using subsetix::test::copy_to_view;
+using subsetix::test::make_mesh_device;
+
+using DeviceSpace = Kokkos::DefaultExecutionSpace::memory_space;
+
+// ============================================================================
+// Test helpers
+// ============================================================================
+
+// Two rows, three intervals, 9 cells
+Mesh3DDevice make_sample_mesh() {
+  return make_mesh_device(
+      {{0, 0}, {1, 2}},
+      {0, 2, 3},
+      {{0, 2}, {5, 8}, {-4, 0}});
+}
+
+std::string read_file(const std::string& path) {
+  std::ifstream is(path, std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+}
+
+std::string temp_path(const std::string& name) {
+  return ::testing::TempDir() + name;
+}
+
+// Offset of the first byte after the '_' marker of the appended data block
+std::size_t appended_start(const std::string& content) {
+  const std::size_t marker = content.find("encoding=\"raw\">");
+  const std::size_t underscore = content.find('_', marker);
+  return underscore + 1;
+}
+
+template <class T>
+T read_native(const std::string& content, std::size_t offset) {
+  T value;
+  std::memcpy(&value, content.data() + offset, sizeof(T));
+  return value;
+}
+
+double read_big_endian_double(const std::string& content, std::size_t offset) {
+  unsigned char bytes[8];
+  for (int i = 0; i < 8; ++i) {
+    bytes[i] = static_cast<unsigned char>(content[offset + 7 - i]);
+  }
+  double value;
+  std::memcpy(&value, bytes, sizeof(double));
+  return value;
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// VTU writer
+// ============================================================================
+
+TEST(VtkTest, VtuIntervalModeOneHexPerInterval) {
+  const std::string path = temp_path("subsetix_interval.vtu");
+  io::write_vtu(path, make_sample_mesh());
+
+  const std::string content = read_file(path);
+  EXPECT_NE(content.find("NumberOfPoints=\"24\" NumberOfCells=\"3\""), std::string::npos);
+
+  // First block: points, 3 hexahedra * 8 corners * 3 doubles
+  const std::size_t start = appended_start(content);
+  EXPECT_EQ(read_native<std::uint64_t>(content, start), 3u * 24u * sizeof(double));
+
+  // Second hexahedron is interval [5, 8) of row (0, 0): corner 6 is (8, 1, 1)
+  const std::size_t corner6 = start + sizeof(std::uint64_t) + (24 + 6 * 3) * sizeof(double);
+  EXPECT_DOUBLE_EQ(read_native<double>(content, corner6 + 0 * sizeof(double)), 8.0);
+  EXPECT_DOUBLE_EQ(read_native<double>(content, corner6 + 1 * sizeof(double)), 1.0);
+  EXPECT_DOUBLE_EQ(read_native<double>(content, corner6 + 2 * sizeof(double)), 1.0);
+
+  // Third hexahedron lies in row (1, 2): corner 0 is (-4, 1, 2)
+  const std::size_t corner0 = start + sizeof(std::uint64_t) + 48 * sizeof(double);
+  EXPECT_DOUBLE_EQ(read_native<double>(content, corner0 + 0 * sizeof(double)), -4.0);
+  EXPECT_DOUBLE_EQ(read_native<double>(content, corner0 + 1 * sizeof(double)), 1.0);
+  EXPECT_DOUBLE_EQ(read_native<double>(content, corner0 + 2 * sizeof(double)), 2.0);
+
+  std::remove(path.c_str());
+}
+
+TEST(VtkTest, VtuCellModeOneHexPerCell) {
+  const std::string path = temp_path("subsetix_cells.vtu");
+  io::VtkOptions options;
+  options.mode = io::VtkCellMode::Cell;
+  io::write_vtu(path, make_sample_mesh(), options);
+
+  const std::string content = read_file(path);
+  EXPECT_NE(content.find("NumberOfPoints=\"72\" NumberOfCells=\"9\""), std::string::npos);
+
+  // Cell 3 is x = 6 in row (0, 0): corner 1 is (7, 0, 0)
+  const std::size_t start = appended_start(content);
+  const std::size_t corner1 = start + sizeof(std::uint64_t) + (3 * 24 + 3) * sizeof(double);
+  EXPECT_DOUBLE_EQ(read_native<double>(content, corner1), 7.0);
+
+  std::remove(path.c_str());
+}
+
+TEST(VtkTest, VtuIntervalModeWritesFieldMean) {
+  const Mesh3DDevice mesh = make_sample_mesh();
+  auto rho = make_field<double>(mesh, "rho");
+  ASSERT_EQ(rho.num_cells, 9u);
+  copy_to_view(std::vector<double>{1, 3, 10, 20, 30, 1, 1, 1, 5}, rho.values);
+
+  const std::string path = temp_path("subsetix_field.vtu");
+  const std::vector<NamedField<double, DeviceSpace>> fields = {{"rho", rho}};
+  io::write_vtu(path, mesh, fields);
+
+  const std::string content = read_file(path);
+  EXPECT_NE(content.find("Name=\"rho\""), std::string::npos);
+
+  // Blocks: points, connectivity, offsets, types, then rho
+  std::size_t offset = appended_start(content);
+  for (int block = 0; block < 4; ++block) {
+    offset += sizeof(std::uint64_t) + read_native<std::uint64_t>(content, offset);
+  }
+  EXPECT_EQ(read_native<std::uint64_t>(content, offset), 3u * sizeof(double));
+  offset += sizeof(std::uint64_t);
+  EXPECT_DOUBLE_EQ(read_native<double>(content, offset + 0 * sizeof(double)), 2.0);
+  EXPECT_DOUBLE_EQ(read_native<double>(content, offset + 1 * sizeof(double)), 20.0);
+  EXPECT_DOUBLE_EQ(read_native<double>(content, offset + 2 * sizeof(double)), 2.0);
+
+  std::remove(path.c_str());
+}
+
+TEST(VtkTest, ChunkSizeDoesNotChangeOutput) {
+  const Mesh3DDevice mesh = make_sample_mesh();
+  io::VtkOptions small;
+  small.mode = io::VtkCellMode::Cell;
+  small.chunk_size = 2;
+  io::VtkOptions large = small;
+  large.chunk_size = 1000;
+
+  const std::string path_small = temp_path("subsetix_chunk_small.vtu");
+  const std::string path_large = temp_path("subsetix_chunk_large.vtu");
+  io::write_vtu(path_small, mesh, small);
+  io::write_vtu(path_large, mesh, large);
+
+  EXPECT_EQ(read_file(path_small), read_file(path_large));
+
+  std::remove(path_small.c_str());
+  std::remove(path_large.c_str());
+}
+
+TEST(VtkTest, EmptyMeshWritesValidHeader) {
+  const std::string path = temp_path("subsetix_empty.vtu");
+  io::write_vtu(path, Mesh3DDevice{});
+
+  const std::string content = read_file(path);
+  EXPECT_NE(content.find("NumberOfPoints=\"0\" NumberOfCells=\"0\""), std::string::npos);
+  EXPECT_NE(content.find("</VTKFile>"), std::string::npos);
+
+  std::remove(path.c_str());
+}
+
+TEST(VtkTest, FieldOnOtherMeshThrows) {
+  const Mesh3DDevice mesh = make_sample_mesh();
+  const Mesh3DDevice other = make_mesh_device({{0, 0}}, {0, 1}, {{0, 4}});
+  auto f = make_field<double>(other, "f");
+
+  const std::string path = temp_path("subsetix_bad.vtu");
+  const std::vector<NamedField<double, DeviceSpace>> fields = {{"f", f}};
+  EXPECT_THROW(io::write_vtu(path, mesh, fields), std::invalid_argument);
+  std::remove(path.c_str());
+}
+
+// ============================================================================
+// Legacy VTK writer
+// ============================================================================
+
+TEST(VtkTest, LegacyVtkIsBigEndian) {
+  const std::string path = temp_path("subsetix_legacy.vtk");
+  io::VtkOptions options;
+  options.spacing = 0.5;
+  options.origin = {1.0, 0.0, 0.0};
+  io::write_vtk(path, make_sample_mesh(), options);
+
+  const std::string content = read_file(path);
+  EXPECT_EQ(content.rfind("# vtk DataFile Version 5.1\n", 0), 0u);
+  EXPECT_NE(content.find("POINTS 24 double\n"), std::string::npos);
+  EXPECT_NE(content.find("CELLS 4 24\n"), std::string::npos);
+  EXPECT_NE(content.find("CELL_TYPES 3\n"), std::string::npos);
+
+  // First corner of the first hexahedron: x = 1 + 0.5 * 0
+  const std::size_t points = content.find("POINTS 24 double\n") + 17;
+  EXPECT_DOUBLE_EQ(read_big_endian_double(content, points), 1.0);
+  // Corner 1 of the first hexahedron: x = 1 + 0.5 * 2
+  EXPECT_DOUBLE_EQ(read_big_endian_double(content, points + 3 * sizeof(double)), 2.0);
+
+  std::remove(path.c_str());
+}